@@ -10,7 +10,10 @@
 
 #pragma once
 
+#include "iterator.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -24,10 +27,10 @@ template <class F>
 class AllOp {
 public:
     template <class Fx>
-    explicit AllOp(Fx &&f);
+    RUSTFP_CONSTEXPR explicit AllOp(Fx &&f);
 
     template <class Iterator>
-    auto operator()(Iterator &&it) && -> bool;
+    RUSTFP_CONSTEXPR auto operator()(Iterator &&it) && -> bool;
 
 private:
     F f;
@@ -39,39 +42,40 @@ private:
  *     F: FnMut(Self::Item) -> bool,
  */
 template <class F>
-auto all(F &&f) -> AllOp<special_decay_t<F>>;
+RUSTFP_CONSTEXPR auto all(F &&f) -> AllOp<special_decay_t<F>>;
 
 // implementation section
 
 template <class F>
 template <class Fx>
-AllOp<F>::AllOp(Fx &&f) : f(std::forward<Fx>(f)) {
+RUSTFP_CONSTEXPR AllOp<F>::AllOp(Fx &&f) : f(std::forward<Fx>(f)) {
 }
 
 template <class F>
 template <class Iterator>
-auto AllOp<F>::operator()(Iterator &&it) && -> bool {
+RUSTFP_CONSTEXPR auto AllOp<F>::operator()(Iterator &&it) && -> bool {
     static_assert(
         !std::is_lvalue_reference<Iterator>::value,
         "all can only take rvalue ref object with Iterator traits");
 
-    while (true) {
-        auto next_opt = it.next();
+    using Item = typename Iterator::Item;
 
-        if (next_opt.is_none()) {
-            break;
-        }
+    // Err is used to break out of the fold at the first false
+    return details::try_fold(
+               it,
+               Unit,
+               [this](unit_t, Item item) -> Result<unit_t, unit_t> {
+                   if (!f(std::forward<Item>(item))) {
+                       return Err(Unit);
+                   }
 
-        if (!f(std::move(next_opt).unwrap_unchecked())) {
-            return false;
-        }
-    }
-
-    return true;
+                   return Ok(Unit);
+               })
+        .is_ok();
 }
 
 template <class F>
-auto all(F &&f) -> AllOp<special_decay_t<F>> {
+RUSTFP_CONSTEXPR auto all(F &&f) -> AllOp<special_decay_t<F>> {
     return AllOp<special_decay_t<F>>(std::forward<F>(f));
 }
 } // namespace rustfp
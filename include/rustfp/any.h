@@ -10,7 +10,10 @@
 
 #pragma once
 
+#include "iterator.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -24,10 +27,10 @@ template <class F>
 class AnyOp {
 public:
     template <class Fx>
-    explicit AnyOp(Fx &&f);
+    RUSTFP_CONSTEXPR explicit AnyOp(Fx &&f);
 
     template <class Iterator>
-    auto operator()(Iterator &&it) && -> bool;
+    RUSTFP_CONSTEXPR auto operator()(Iterator &&it) && -> bool;
 
 private:
     F f;
@@ -39,39 +42,40 @@ private:
  *     F: FnMut(Self::Item) -> bool,
  */
 template <class F>
-auto any(F &&f) -> AnyOp<special_decay_t<F>>;
+RUSTFP_CONSTEXPR auto any(F &&f) -> AnyOp<special_decay_t<F>>;
 
 // implementation section
 
 template <class F>
 template <class Fx>
-AnyOp<F>::AnyOp(Fx &&f) : f(std::forward<Fx>(f)) {
+RUSTFP_CONSTEXPR AnyOp<F>::AnyOp(Fx &&f) : f(std::forward<Fx>(f)) {
 }
 
 template <class F>
 template <class Iterator>
-auto AnyOp<F>::operator()(Iterator &&it) && -> bool {
+RUSTFP_CONSTEXPR auto AnyOp<F>::operator()(Iterator &&it) && -> bool {
     static_assert(
         !std::is_lvalue_reference<Iterator>::value,
         "any can only take rvalue ref object with Iterator traits");
 
-    while (true) {
-        auto next_opt = it.next();
+    using Item = typename Iterator::Item;
 
-        if (next_opt.is_none()) {
-            break;
-        }
+    // Err is used to break out of the fold at the first true
+    return details::try_fold(
+               it,
+               Unit,
+               [this](unit_t, Item item) -> Result<unit_t, unit_t> {
+                   if (f(std::forward<Item>(item))) {
+                       return Err(Unit);
+                   }
 
-        if (f(std::move(next_opt).unwrap_unchecked())) {
-            return true;
-        }
-    }
-
-    return false;
+                   return Ok(Unit);
+               })
+        .is_err();
 }
 
 template <class F>
-auto any(F &&f) -> AnyOp<special_decay_t<F>> {
+RUSTFP_CONSTEXPR auto any(F &&f) -> AnyOp<special_decay_t<F>> {
     return AnyOp<special_decay_t<F>>(std::forward<F>(f));
 }
 } // namespace rustfp
@@ -0,0 +1,299 @@
+/**
+ * Contains Rust Iterator chain equivalent implementation.
+ *
+ * chain function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.chain
+ *
+ * Chain struct:
+ * https://doc.rust-lang.org/std/iter/struct.Chain.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "result.h"
+#include "util.h"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<A, B> Iterator for Chain<A, B>
+ * where
+ *     A: Iterator,
+ *     B: Iterator<Item = <A as Iterator>::Item>,
+ * type Item = <A as Iterator>::Item
+ */
+template <class Self, class Other>
+class Chain {
+public:
+    static_assert(
+        std::is_same<typename Self::Item, typename Other::Item>::value,
+        "chain requires both iterators to have the same Item type");
+
+    /**
+     * Type alias to rustfp Iter type for Self.
+     */
+    using A = Self;
+
+    /**
+     * Type alias to rustfp Iter type for Other (RHS).
+     */
+    using B = Other;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = typename Self::Item;
+
+    /**
+     * Takes in both the moved rustfp Iter instances.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @tparam Otherx Forwarded type of Other, rustfp Iter type
+     * @param self rustfp Iter instance to generate the items from first
+     * @param other rustfp Iter instance to generate the items from after self
+     * runs out of items
+     */
+    template <class Selfx, class Otherx>
+    Chain(Selfx &&self, Otherx &&other);
+
+    /**
+     * Generates the next item of self, or of other once self has run out of
+     * items.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left in both iterators. The
+     * upper bound is None if either upper bound is None, or if their sum
+     * overflows.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in both iterators. Only
+     * available if both iterators are exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_exact_size<S>::value
+            && details::is_exact_size<O>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of self and then to the fold of other, so each
+     * half runs its own loop without checking which half it is in.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of self and then to the try_fold of other.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Generates the next item from the back of other, or of self once other
+     * has run out of items. Only available if both iterators are
+     * double-ended.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_double_ended<S>::value
+            && details::is_double_ended<O>::value>>
+    auto next_back() -> Option<Item>;
+
+private:
+    Self self;
+    Other other;
+    bool self_done;
+};
+
+template <class Other>
+class ChainOp {
+public:
+    template <class Otherx>
+    explicit ChainOp(Otherx &&other);
+
+    template <class Self>
+    auto operator()(Self &&self) && -> Chain<Self, Other>;
+
+private:
+    Other other;
+};
+
+/**
+ * fn chain<U>(self, other: U) -> Chain<Self, <U as IntoIterator>::IntoIter>
+ * where
+ *     U: IntoIterator<Item = Self::Item>,
+ */
+template <class U>
+auto chain(U &&other) -> ChainOp<U>;
+
+// implementation section
+
+template <class Self, class Other>
+template <class Selfx, class Otherx>
+Chain<Self, Other>::Chain(Selfx &&self, Otherx &&other)
+    : self(std::forward<Selfx>(self)), other(std::forward<Otherx>(other)),
+      self_done(false) {
+}
+
+template <class Self, class Other>
+auto Chain<Self, Other>::next() -> Option<Item> {
+    if (!self_done) {
+        auto item_opt = self.next();
+
+        if (item_opt.is_some()) {
+            return item_opt;
+        }
+
+        self_done = true;
+    }
+
+    return other.next();
+}
+
+template <class Self, class Other>
+auto Chain<Self, Other>::size_hint() const -> size_hint_t {
+    const auto other_hint = details::size_hint(other);
+
+    if (self_done) {
+        return other_hint;
+    }
+
+    const auto self_hint = details::size_hint(self);
+    const auto max_len = std::numeric_limits<size_t>::max();
+
+    const auto lower = self_hint.first > max_len - other_hint.first
+                           ? max_len
+                           : self_hint.first + other_hint.first;
+
+    if (self_hint.second.is_none() || other_hint.second.is_none()) {
+        return size_hint_t(lower, None);
+    }
+
+    const auto self_upper = self_hint.second.get_unchecked();
+    const auto other_upper = other_hint.second.get_unchecked();
+
+    if (self_upper > max_len - other_upper) {
+        return size_hint_t(lower, None);
+    }
+
+    return size_hint_t(lower, Some(self_upper + other_upper));
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Chain<Self, Other>::len() const -> size_t {
+    return self_done ? other.len() : self.len() + other.len();
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Chain<Self, Other>::fold(Acc init, G &&g) -> Acc {
+    if (!self_done) {
+        init = details::fold(self, std::move(init), g);
+        self_done = true;
+    }
+
+    return details::fold(other, std::move(init), g);
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Chain<Self, Other>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using R = try_fold_t<Acc, G, Item>;
+
+    if (!self_done) {
+        R res = details::try_fold(self, std::move(init), g);
+
+        if (res.is_err()) {
+            return res;
+        }
+
+        init = std::move(res).unwrap_unchecked();
+        self_done = true;
+    }
+
+    return details::try_fold(other, std::move(init), g);
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Chain<Self, Other>::next_back() -> Option<Item> {
+    auto item_opt = other.next_back();
+
+    if (item_opt.is_some()) {
+        return item_opt;
+    }
+
+    if (self_done) {
+        return None;
+    }
+
+    return self.next_back();
+}
+
+template <class Other>
+template <class Otherx>
+ChainOp<Other>::ChainOp(Otherx &&other) : other(std::move(other)) {
+}
+
+template <class Other>
+template <class Self>
+auto ChainOp<Other>::operator()(Self &&self) && -> Chain<Self, Other> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "chain can only take rvalue ref object with Iterator traits");
+
+    return Chain<Self, Other>(std::move(self), std::move(other));
+}
+
+template <class U>
+auto chain(U &&other) -> ChainOp<U> {
+    static_assert(
+        !std::is_lvalue_reference<U>::value,
+        "chain can only take second rvalue ref object with Iterator traits");
+
+    return ChainOp<U>(std::move(other));
+}
+} // namespace rustfp
@@ -0,0 +1,409 @@
+/**
+ * Contains Rust slice chunks and Iterator array_chunks equivalent
+ * implementations.
+ *
+ * chunks function:
+ * https://doc.rust-lang.org/std/primitive.slice.html#method.chunks
+ *
+ * array_chunks function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.array_chunks
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "slice.h"
+#include "util.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<'a, T> Iterator for Chunks<'a, T>
+ * type Item = &'a [T]
+ *
+ * Generates Slice views of up to size consecutive values of a contiguous
+ * iterator such as ContiguousIter, where only the last chunk may be shorter.
+ * No values are copied.
+ */
+template <class Self, bool = details::is_contiguous<Self>::value>
+class Chunks {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = Slice<std::remove_reference_t<typename Self::Item>>;
+
+    /**
+     * Takes in the moved rustfp Iter instance and the chunk size.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     * @param size Maximum number of values in each chunk, which must not be 0
+     */
+    template <class Selfx>
+    Chunks(Selfx &&self, const size_t size);
+
+    /**
+     * Generates the next chunk of values.
+     * @return Some(Item) if there are values left, otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of chunks left, which is always exact.
+     * @return (lower bound, upper bound) of the number of chunks left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of chunks left.
+     * @return Number of chunks left.
+     */
+    auto len() const -> size_t;
+
+private:
+    Self self;
+    size_t size;
+};
+
+/**
+ * Generates Slice views of up to size consecutive items of any other
+ * iterator, whose items are moved into a buffer that is reused across chunks.
+ * Each Slice is only valid until the next call to next.
+ */
+template <class Self>
+class Chunks<Self, false> {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Type of the values stored in the buffer.
+     */
+    using Value = std::decay_t<typename Self::Item>;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = Slice<const Value>;
+
+    /**
+     * Takes in the moved rustfp Iter instance and the chunk size.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     * @param size Maximum number of items in each chunk, which must not be 0
+     */
+    template <class Selfx>
+    Chunks(Selfx &&self, const size_t size);
+
+    /**
+     * Generates the next chunk of items.
+     * @return Some(Item) if there are items left, otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of chunks left.
+     * @return (lower bound, upper bound) of the number of chunks left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of chunks left. Only available if the
+     * underlying iterator is exact size.
+     * @return Number of chunks left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+private:
+    Self self;
+    size_t size;
+    std::vector<Value> buffer;
+};
+
+/**
+ * impl<I, const N: usize> Iterator for ArrayChunks<I, N>
+ * where
+ *     I: Iterator,
+ * type Item = [<I as Iterator>::Item; N]
+ *
+ * Generates std::array of exactly N items by value, so that the operations
+ * on each chunk can be unrolled. The items left that cannot fill up a chunk
+ * are not generated.
+ */
+template <class Self, size_t N>
+class ArrayChunks {
+public:
+    static_assert(N > 0, "array_chunks requires N to be greater than 0");
+
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = std::array<std::decay_t<typename Self::Item>, N>;
+
+    /**
+     * Takes in the moved rustfp Iter instance.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     */
+    template <class Selfx>
+    explicit ArrayChunks(Selfx &&self);
+
+    /**
+     * Generates the next chunk of N items. Copies the items by offset if the
+     * underlying iterator is trusted random access, which keeps the loop free
+     * of checks for the end of iteration.
+     * @return Some(Item) if there are at least N items left, otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of chunks left.
+     * @return (lower bound, upper bound) of the number of chunks left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of chunks left. Only available if the
+     * underlying iterator is exact size.
+     * @return Number of chunks left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+private:
+    auto next_impl(std::true_type) -> Option<Item>;
+    auto next_impl(std::false_type) -> Option<Item>;
+
+    Self self;
+};
+
+class ChunksOp {
+public:
+    explicit ChunksOp(const size_t size);
+
+    template <class Self>
+    auto operator()(Self &&self) && -> Chunks<Self>;
+
+private:
+    size_t size;
+};
+
+template <size_t N>
+class ArrayChunksOp {
+public:
+    template <class Self>
+    auto operator()(Self &&self) && -> ArrayChunks<Self, N>;
+};
+
+/**
+ * fn chunks(&self, chunk_size: usize) -> Chunks<T>
+ */
+auto chunks(const size_t size) -> ChunksOp;
+
+/**
+ * fn array_chunks<const N: usize>(self) -> ArrayChunks<Self, N>
+ */
+template <size_t N>
+auto array_chunks() -> ArrayChunksOp<N>;
+
+// implementation section
+
+template <class Self, bool Contiguous>
+template <class Selfx>
+Chunks<Self, Contiguous>::Chunks(Selfx &&self, const size_t size)
+    : self(std::forward<Selfx>(self)), size(size) {
+
+    assert(size > 0);
+}
+
+template <class Self, bool Contiguous>
+auto Chunks<Self, Contiguous>::next() -> Option<Item> {
+    const auto len = std::min(self.len(), size);
+
+    if (len == 0) {
+        return None;
+    }
+
+    const auto ptr = self.as_ptr();
+    details::advance_by(self, len);
+    return Some(Item(ptr, len));
+}
+
+template <class Self, bool Contiguous>
+auto Chunks<Self, Contiguous>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(len());
+}
+
+template <class Self, bool Contiguous>
+auto Chunks<Self, Contiguous>::len() const -> size_t {
+    return details::div_ceil(self.len(), size);
+}
+
+template <class Self>
+template <class Selfx>
+Chunks<Self, false>::Chunks(Selfx &&self, const size_t size)
+    : self(std::forward<Selfx>(self)), size(size) {
+
+    assert(size > 0);
+    buffer.reserve(size);
+}
+
+template <class Self>
+auto Chunks<Self, false>::next() -> Option<Item> {
+    buffer.clear();
+
+    while (buffer.size() < size) {
+        auto item_opt = self.next();
+
+        if (item_opt.is_none()) {
+            break;
+        }
+
+        buffer.push_back(std::move(item_opt).unwrap_unchecked());
+    }
+
+    if (buffer.empty()) {
+        return None;
+    }
+
+    return Some(Item(buffer.data(), buffer.size()));
+}
+
+template <class Self>
+auto Chunks<Self, false>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    return size_hint_t(
+        details::div_ceil(hint.first, size),
+        hint.second.is_some()
+            ? Some(details::div_ceil(hint.second.get_unchecked(), size))
+            : None);
+}
+
+template <class Self>
+template <class S, class>
+auto Chunks<Self, false>::len() const -> size_t {
+    return details::div_ceil(self.len(), size);
+}
+
+template <class Self, size_t N>
+template <class Selfx>
+ArrayChunks<Self, N>::ArrayChunks(Selfx &&self)
+    : self(std::forward<Selfx>(self)) {
+}
+
+template <class Self, size_t N>
+auto ArrayChunks<Self, N>::next() -> Option<Item> {
+    return next_impl(details::is_trusted_random_access<Self>());
+}
+
+template <class Self, size_t N>
+auto ArrayChunks<Self, N>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    return size_hint_t(
+        hint.first / N,
+        hint.second.is_some() ? Some(hint.second.get_unchecked() / N) : None);
+}
+
+template <class Self, size_t N>
+template <class S, class>
+auto ArrayChunks<Self, N>::len() const -> size_t {
+    return self.len() / N;
+}
+
+template <class Self, size_t N>
+auto ArrayChunks<Self, N>::next_impl(std::true_type) -> Option<Item> {
+    if (self.len() < N) {
+        return None;
+    }
+
+    Item chunk;
+
+    for (size_t i = 0; i < N; ++i) {
+        chunk[i] = self.at_unchecked(i);
+    }
+
+    details::advance_by(self, N);
+    return Some(std::move(chunk));
+}
+
+template <class Self, size_t N>
+auto ArrayChunks<Self, N>::next_impl(std::false_type) -> Option<Item> {
+    Item chunk;
+
+    for (size_t i = 0; i < N; ++i) {
+        auto item_opt = self.next();
+
+        if (item_opt.is_none()) {
+            return None;
+        }
+
+        chunk[i] = std::move(item_opt).unwrap_unchecked();
+    }
+
+    return Some(std::move(chunk));
+}
+
+inline ChunksOp::ChunksOp(const size_t size) : size(size) {
+}
+
+template <class Self>
+auto ChunksOp::operator()(Self &&self) && -> Chunks<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "chunks can only take rvalue ref object with Iterator traits");
+
+    return Chunks<Self>(std::move(self), size);
+}
+
+template <size_t N>
+template <class Self>
+auto ArrayChunksOp<N>::operator()(Self &&self) && -> ArrayChunks<Self, N> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "array_chunks can only take rvalue ref object with Iterator traits");
+
+    return ArrayChunks<Self, N>(std::move(self));
+}
+
+inline auto chunks(const size_t size) -> ChunksOp {
+    return ChunksOp(size);
+}
+
+template <size_t N>
+auto array_chunks() -> ArrayChunksOp<N> {
+    return ArrayChunksOp<N>();
+}
+} // namespace rustfp
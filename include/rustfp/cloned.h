@@ -12,9 +12,13 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
+#include "unit.h"
 #include "util.h"
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -63,6 +67,96 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left, which is the same as the
+     * underlying iterator.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, which is the same as the
+     * underlying iterator. Only available if the underlying iterator is exact
+     * size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds, by cloning the item at the same offset
+     * of the underlying iterator.
+     * Only available if the underlying iterator supports at_unchecked.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_trusted_random_access<S>::value>>
+    auto at_unchecked(const size_t i) -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the underlying iterator by n items without generating them.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value of cloned operation from the back.
+     * Only available if the underlying iterator is double-ended.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_double_ended<S>::value>>
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the underlying iterator from the back by n items without
+     * generating them. Only available if the underlying iterator is
+     * double-ended.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_double_ended<S>::value>>
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
 private:
     Self self;
 };
@@ -93,6 +187,64 @@ auto Cloned<Self>::next() -> Option<Item> {
     return self.next().map([](auto &&value) -> Item { return value; });
 }
 
+template <class Self>
+auto Cloned<Self>::size_hint() const -> size_hint_t {
+    return details::size_hint(self);
+}
+
+template <class Self>
+template <class S, class>
+auto Cloned<Self>::len() const -> size_t {
+    return self.len();
+}
+
+template <class Self>
+template <class S, class>
+auto Cloned<Self>::at_unchecked(const size_t i) -> Item {
+    return self.at_unchecked(i);
+}
+
+template <class Self>
+template <class Acc, class G>
+auto Cloned<Self>::fold(Acc init, G &&g) -> Acc {
+    using SelfItem = typename Self::Item;
+
+    return details::fold(
+        self, std::move(init), [&g](Acc acc, SelfItem item) -> Acc {
+            return g(std::move(acc), Item(item));
+        });
+}
+
+template <class Self>
+template <class Acc, class G>
+auto Cloned<Self>::try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item> {
+    using SelfItem = typename Self::Item;
+
+    return details::try_fold(
+        self, std::move(init), [&g](Acc acc, SelfItem item) {
+            return g(std::move(acc), Item(item));
+        });
+}
+
+template <class Self>
+auto Cloned<Self>::advance_by(const size_t n) -> Result<unit_t, size_t> {
+    return details::advance_by(self, n);
+}
+
+template <class Self>
+template <class S, class>
+auto Cloned<Self>::next_back() -> Option<Item> {
+    return self.next_back().map([](auto &&value) -> Item { return value; });
+}
+
+template <class Self>
+template <class S, class>
+auto Cloned<Self>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::advance_back_by(self, n);
+}
+
 template <class Self>
 auto ClonedOp::operator()(Self &&self) && -> Cloned<Self> {
     static_assert(
@@ -10,10 +10,14 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -31,6 +35,8 @@ public:
      * @param self moved rustfp iterator.
      * @return specified container type with all the values collected
      * via push_back. Order of insertion is done via the order of .next().
+     * Containers with reserve(n) method are pre-allocated with the lower
+     * bound of size_hint() of the iterator.
      */
     template <class Self>
     auto operator()(Self &&self) && -> B;
@@ -47,11 +53,27 @@ public:
      * @return Ok(container type) if no error while collecting,
      * Err(error type) upon the first error encountered while
      * collecting. Order of insertion is done via the order of .next().
+     * Containers with reserve(n) method are pre-allocated with the lower
+     * bound of size_hint() of the iterator.
      */
     template <class Self>
     auto operator()(Self &&self) && -> Result<OkType, ErrType>;
 };
 
+template <class T, size_t N>
+class CollectOp<std::array<T, N>> {
+public:
+    /**
+     * Accept only std::array<T, N>, where the first N values are collected
+     * in order and the elements left once the iterator runs out of values are
+     * value-initialized. Usable in constant expressions.
+     * @param self moved rustfp iterator.
+     * @return std::array with the first N values collected via .next().
+     */
+    template <class Self>
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> std::array<T, N>;
+};
+
 /**
  * fn collect<B>(self) -> B
  * where
@@ -59,10 +81,11 @@ public:
  *
  * Collect into any container type that is able to invoke
  * push_back(value), insert(value) or push(value) method.
- * Can also collect into Result<container type, error type>.
+ * Can also collect into Result<container type, error type>, or into
+ * std::array<T, N> in constant expressions.
  */
 template <class B>
-auto collect() -> CollectOp<B>;
+RUSTFP_CONSTEXPR auto collect() -> CollectOp<B>;
 
 // implementation section
 
@@ -100,21 +123,59 @@ auto inserter(
     };
 }
 
+template <class B, class = void>
+struct has_reserve : std::false_type {};
+
+template <class B>
+struct has_reserve<
+    B,
+    void_t<decltype(std::declval<B &>().reserve(std::declval<size_t>()))>>
+    : std::true_type {};
+
+template <class B>
+auto reserve_impl(B &container, const size_t count, std::true_type) -> void {
+    container.reserve(count);
+}
+
+template <class B>
+auto reserve_impl(B &, const size_t, std::false_type) -> void {
+}
+
+template <class B>
+auto reserve(B &container, const size_t count) -> void {
+    reserve_impl(container, count, has_reserve<B>());
+}
+
 template <class B, class Self, class InsertFn>
 auto collect_impl(Self &&self, InsertFn &&insert_fn) -> B {
+    using Item = typename std::remove_reference_t<Self>::Item;
+
     B container;
+    reserve(container, size_hint(self).first);
 
-    while (true) {
-        auto next_opt = self.next();
+    fold(self, Unit, [&container, &insert_fn](unit_t, Item item) {
+        insert_fn(container, std::forward<Item>(item));
+        return Unit;
+    });
 
-        if (next_opt.is_none()) {
-            break;
-        }
+    return container;
+}
 
-        insert_fn(container, std::move(next_opt).unwrap_unchecked());
-    }
+template <class T, class Self>
+RUSTFP_CONSTEXPR auto next_or_default(Self &self) -> T {
+    auto next_opt = self.next();
 
-    return container;
+    return next_opt.is_some() ? T(std::move(next_opt).unwrap_unchecked())
+                              : T();
+}
+
+// elements in a braced initializer list are evaluated in order, so the array
+// is filled in the order of .next() without having to assign to its elements
+template <class T, size_t N, class Self, size_t... Is>
+RUSTFP_CONSTEXPR auto collect_array(Self &self, std::index_sequence<Is...>)
+    -> std::array<T, N> {
+
+    return {{(static_cast<void>(Is), next_or_default<T>(self))...}};
 }
 } // namespace details
 
@@ -140,35 +201,49 @@ operator()(Self &&self) && -> Result<OkType, ErrType> {
         "CollectOp<Result<OkType, Err>> for types with push method "
         "can only take rvalue ref object with Iterator traits");
 
+    using ItemResult = std::decay_t<typename Self::Item>;
+
     const auto insert_fn =
         details::inserter<OkType, typename OkType::value_type>();
     OkType container;
+    details::reserve(container, details::size_hint(self).first);
 
-    while (true) {
-        auto next_res_opt = self.next();
-
-        if (next_res_opt.is_none()) {
-            break;
-        }
+    auto res = details::try_fold(
+        self,
+        Unit,
+        [&container, &insert_fn](
+            unit_t, ItemResult next_res) -> Result<unit_t, ErrType> {
 
-        auto next_res = std::move(next_res_opt).unwrap_unchecked();
+            if (RUSTFP_UNLIKELY(next_res.is_err())) {
+                return details::forward_err(std::move(next_res));
+            }
 
-        if (next_res.is_err()) {
-            // because error type may be a reference
-            // must perform reverse decay here since Err will special
-            // decay the given type
-            return Err(
-                reverse_decay(std::move(next_res).unwrap_err_unchecked()));
-        }
+            insert_fn(container, std::move(next_res).unwrap_unchecked());
+            return Ok(Unit);
+        });
 
-        insert_fn(container, std::move(next_res).unwrap_unchecked());
+    if (RUSTFP_UNLIKELY(res.is_err())) {
+        return details::forward_err(std::move(res));
     }
 
     return Ok(std::move(container));
 }
 
+template <class T, size_t N>
+template <class Self>
+RUSTFP_CONSTEXPR auto CollectOp<std::array<T, N>>::
+operator()(Self &&self) && -> std::array<T, N> {
+
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "CollectOp<std::array<T, N>> can only take rvalue ref object with "
+        "Iterator traits");
+
+    return details::collect_array<T, N>(self, std::make_index_sequence<N>());
+}
+
 template <class B>
-auto collect() -> CollectOp<B> {
+RUSTFP_CONSTEXPR auto collect() -> CollectOp<B> {
     return CollectOp<B>();
 }
 } // namespace rustfp
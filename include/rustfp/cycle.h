@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
 #include "traits.h"
 
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -65,6 +67,13 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left, which is (0, Some(0))
+     * for an empty iterator, and unbounded otherwise.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
 private:
     reverse_decay_t<Self> self;
     reverse_decay_t<Self> ref_self;
@@ -104,6 +113,18 @@ auto Cycle<Self>::next() -> Option<Item> {
     }
 }
 
+template <class Self>
+auto Cycle<Self>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(ref_self);
+
+    if (hint.second.is_some() && hint.second.get_unchecked() == 0) {
+        return hint;
+    }
+
+    return size_hint_t(
+        hint.first == 0 ? 0 : std::numeric_limits<size_t>::max(), None);
+}
+
 template <class Self>
 auto CycleOp::operator()(Self &&self) && -> Cycle<Self> {
     static_assert(
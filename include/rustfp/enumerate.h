@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -58,6 +61,86 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left, which is the same as the
+     * underlying iterator.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, which is the same as the
+     * underlying iterator. Only available if the underlying iterator is exact
+     * size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds, paired with the index of the item.
+     * Only available if the underlying iterator supports at_unchecked.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_trusted_random_access<S>::value>>
+    auto at_unchecked(const size_t i) -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the underlying iterator by n items without generating them.
+     * The index is advanced by the same number of items.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value of enumerate operation from the back.
+     * Only available if the underlying iterator is double-ended and exact size,
+     * since the index of the last item depends on the number of items left.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<
+            details::is_double_ended<S>::value
+            && details::is_exact_size<S>::value>>
+    auto next_back() -> Option<Item>;
+
 private:
     Self self;
     size_t index;
@@ -90,6 +173,67 @@ auto Enumerate<Iterator>::next() -> Option<Item> {
     });
 }
 
+template <class Self>
+auto Enumerate<Self>::size_hint() const -> size_hint_t {
+    return details::size_hint(self);
+}
+
+template <class Self>
+template <class S, class>
+auto Enumerate<Self>::len() const -> size_t {
+    return self.len();
+}
+
+template <class Self>
+template <class S, class>
+auto Enumerate<Self>::at_unchecked(const size_t i) -> Item {
+    return Item(index + i, self.at_unchecked(i));
+}
+
+template <class Self>
+template <class Acc, class G>
+auto Enumerate<Self>::fold(Acc init, G &&g) -> Acc {
+    using SelfItem = typename Self::Item;
+
+    return details::fold(
+        self, std::move(init), [this, &g](Acc acc, SelfItem item) -> Acc {
+            return g(
+                std::move(acc),
+                Item(index++, std::forward<SelfItem>(item)));
+        });
+}
+
+template <class Self>
+template <class Acc, class G>
+auto Enumerate<Self>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using SelfItem = typename Self::Item;
+
+    return details::try_fold(
+        self, std::move(init), [this, &g](Acc acc, SelfItem item) {
+            return g(
+                std::move(acc),
+                Item(index++, std::forward<SelfItem>(item)));
+        });
+}
+
+template <class Self>
+auto Enumerate<Self>::advance_by(const size_t n) -> Result<unit_t, size_t> {
+    auto res = details::advance_by(self, n);
+    index += res.is_ok() ? n : n - res.get_err_unchecked();
+    return res;
+}
+
+template <class Self>
+template <class S, class>
+auto Enumerate<Self>::next_back() -> Option<Item> {
+    return self.next_back().map([this](auto &&value) {
+        return std::pair<size_t, typename Self::Item>(
+            index + self.len(), std::forward<typename Self::Item>(value));
+    });
+}
+
 template <class Self>
 auto EnumerateOp::operator()(Self &&self) && -> Enumerate<Self> {
     static_assert(
@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
 #include "util.h"
 
@@ -52,14 +54,61 @@ public:
      * @param f Function type F instance
      */
     template <class Selfx, class Px>
-    Filter(Selfx &&self, Px &&p);
+    RUSTFP_CONSTEXPR Filter(Selfx &&self, Px &&p);
 
     /**
      * Generates the next value of filter operation.
      * @return Some(Item) if there is a next value to generate,
      * otherwise None.
      */
-    auto next() -> Option<Item>;
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left. The lower bound is always
+     * 0 since any item may be filtered away.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator, skipping the items
+     * that do not satisfy the predicate.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator, skipping the
+     * items that do not satisfy the predicate.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Generates the next value of filter operation from the back.
+     * Only available if the underlying iterator is double-ended.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_double_ended<S>::value>>
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
 
 private:
     Self self;
@@ -70,10 +119,10 @@ template <class P>
 class FilterOp {
 public:
     template <class Px>
-    explicit FilterOp(Px &&p);
+    RUSTFP_CONSTEXPR explicit FilterOp(Px &&p);
 
     template <class Self>
-    auto operator()(Self &&self) && -> Filter<Self, P>;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> Filter<Self, P>;
 
 private:
     P p;
@@ -85,18 +134,66 @@ private:
  *     P: FnMut(&Self::Item) -> bool,
  */
 template <class P>
-auto filter(P &&p) -> FilterOp<special_decay_t<P>>;
+RUSTFP_CONSTEXPR auto filter(P &&p) -> FilterOp<special_decay_t<P>>;
 
 // implementation section
 
+namespace details {
+// passes only the items that satisfy p to g, as a function object instead of
+// a lambda so that Filter can be folded in constant expressions before C++17
+template <class Acc, class Item, class P, class G>
+class FilterFoldFn {
+public:
+    RUSTFP_CONSTEXPR FilterFoldFn(P &p, G &g) RUSTFP_NOEXCEPT : p(&p), g(&g) {
+    }
+
+    RUSTFP_CONSTEXPR auto operator()(Acc acc, Item item) const -> Acc {
+        if ((*p)(as_const(item))) {
+            return (*g)(std::move(acc), std::forward<Item>(item));
+        }
+
+        return acc;
+    }
+
+private:
+    P *p;
+    G *g;
+};
+
+// same as FilterFoldFn, but for try_fold, where the accumulator is passed on
+// as Ok for the items that do not satisfy p
+template <class Acc, class Item, class P, class G>
+class FilterTryFoldFn {
+public:
+    RUSTFP_CONSTEXPR FilterTryFoldFn(P &p, G &g) RUSTFP_NOEXCEPT
+        : p(&p),
+          g(&g) {
+    }
+
+    RUSTFP_CONSTEXPR auto operator()(Acc acc, Item item) const
+        -> try_fold_t<Acc, G, Item> {
+
+        if ((*p)(as_const(item))) {
+            return (*g)(std::move(acc), std::forward<Item>(item));
+        }
+
+        return Ok(std::move(acc));
+    }
+
+private:
+    P *p;
+    G *g;
+};
+} // namespace details
+
 template <class Self, class P>
 template <class Selfx, class Px>
-Filter<Self, P>::Filter(Selfx &&self, Px &&p)
+RUSTFP_CONSTEXPR Filter<Self, P>::Filter(Selfx &&self, Px &&p)
     : self(std::forward<Selfx>(self)), p(std::forward<Px>(p)) {
 }
 
 template <class Self, class P>
-auto Filter<Self, P>::next() -> Option<Item> {
+RUSTFP_CONSTEXPR auto Filter<Self, P>::next() -> Option<Item> {
     while (true) {
         auto next_opt = self.next();
 
@@ -112,14 +209,59 @@ auto Filter<Self, P>::next() -> Option<Item> {
     return None;
 }
 
+template <class Self, class P>
+RUSTFP_CONSTEXPR auto Filter<Self, P>::size_hint() const -> size_hint_t {
+    return size_hint_t(0, details::size_hint(self).second);
+}
+
+template <class Self, class P>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Filter<Self, P>::fold(Acc init, G &&g) -> Acc {
+    using fold_fn_t =
+        details::FilterFoldFn<Acc, Item, P, std::remove_reference_t<G>>;
+
+    return details::fold(self, std::move(init), fold_fn_t(p, g));
+}
+
+template <class Self, class P>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Filter<Self, P>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using fold_fn_t =
+        details::FilterTryFoldFn<Acc, Item, P, std::remove_reference_t<G>>;
+
+    return details::try_fold(self, std::move(init), fold_fn_t(p, g));
+}
+
+template <class Self, class P>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Filter<Self, P>::next_back() -> Option<Item> {
+    while (true) {
+        auto next_opt = self.next_back();
+
+        if (next_opt.is_none()) {
+            break;
+        }
+
+        if (p(next_opt.get_unchecked())) {
+            return next_opt;
+        }
+    }
+
+    return None;
+}
+
 template <class P>
 template <class Px>
-FilterOp<P>::FilterOp(Px &&p) : p(std::forward<Px>(p)) {
+RUSTFP_CONSTEXPR FilterOp<P>::FilterOp(Px &&p) : p(std::forward<Px>(p)) {
 }
 
 template <class P>
 template <class Self>
-auto FilterOp<P>::operator()(Self &&self) && -> Filter<Self, P> {
+RUSTFP_CONSTEXPR auto FilterOp<P>::operator()(Self &&self)
+    && -> Filter<Self, P> {
+
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "filter can only take rvalue ref object with Iterator traits");
@@ -128,7 +270,7 @@ auto FilterOp<P>::operator()(Self &&self) && -> Filter<Self, P> {
 }
 
 template <class P>
-auto filter(P &&p) -> FilterOp<special_decay_t<P>> {
+RUSTFP_CONSTEXPR auto filter(P &&p) -> FilterOp<special_decay_t<P>> {
     return FilterOp<special_decay_t<P>>(std::forward<P>(p));
 }
 } // namespace rustfp
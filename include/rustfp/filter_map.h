@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
 #include "util.h"
 
@@ -66,6 +68,42 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left. The lower bound is always
+     * 0 since any item may be filtered away.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator, skipping the items
+     * that are mapped into None.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator, skipping the
+     * items that are mapped into None.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
 private:
     Self self;
     F f;
@@ -119,6 +157,51 @@ auto FilterMap<Self, F>::next() -> Option<Item> {
     return None;
 }
 
+template <class Self, class F>
+auto FilterMap<Self, F>::size_hint() const -> size_hint_t {
+    return size_hint_t(0, details::size_hint(self).second);
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+auto FilterMap<Self, F>::fold(Acc init, G &&g) -> Acc {
+    using SelfItem = typename Self::Item;
+
+    return details::fold(
+        self, std::move(init), [this, &g](Acc acc, SelfItem item) -> Acc {
+            auto mapped_opt = f(std::forward<SelfItem>(item));
+
+            if (mapped_opt.is_some()) {
+                return g(
+                    std::move(acc), std::move(mapped_opt).unwrap_unchecked());
+            }
+
+            return acc;
+        });
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+auto FilterMap<Self, F>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using SelfItem = typename Self::Item;
+
+    return details::try_fold(
+        self,
+        std::move(init),
+        [this, &g](Acc acc, SelfItem item) -> try_fold_t<Acc, G, Item> {
+            auto mapped_opt = f(std::forward<SelfItem>(item));
+
+            if (mapped_opt.is_some()) {
+                return g(
+                    std::move(acc), std::move(mapped_opt).unwrap_unchecked());
+            }
+
+            return Ok(std::move(acc));
+        });
+}
+
 template <class F>
 template <class Fx>
 FilterMapOp<F>::FilterMapOp(Fx &&f) : f(std::forward<Fx>(f)) {
@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -27,10 +30,11 @@ template <class P>
 class FindOp {
 public:
     template <class Px>
-    explicit FindOp(Px &&p);
+    RUSTFP_CONSTEXPR explicit FindOp(Px &&p);
 
     template <class Self>
-    auto operator()(Self &&self) && -> Option<typename Self::Item>;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self)
+        && -> Option<typename Self::Item>;
 
 private:
     P p;
@@ -42,39 +46,42 @@ private:
  *     P: FnMut(&Self::Item) -> bool,
  */
 template <class P>
-auto find(P &&p) -> FindOp<special_decay_t<P>>;
+RUSTFP_CONSTEXPR auto find(P &&p) -> FindOp<special_decay_t<P>>;
 
 // implementation section
 
 template <class P>
 template <class Px>
-FindOp<P>::FindOp(Px &&p) : p(std::forward<Px>(p)) {
+RUSTFP_CONSTEXPR FindOp<P>::FindOp(Px &&p) : p(std::forward<Px>(p)) {
 }
 
 template <class P>
 template <class Self>
-auto FindOp<P>::operator()(Self &&self) && -> Option<typename Self::Item> {
+RUSTFP_CONSTEXPR auto FindOp<P>::operator()(Self &&self)
+    && -> Option<typename Self::Item> {
+
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "find can only take rvalue ref object with Iterator traits");
 
-    while (true) {
-        auto next_opt = self.next();
+    using Item = typename Self::Item;
 
-        if (next_opt.is_none()) {
-            break;
-        }
+    // Err carries the first item found out of the fold, similar to Rust
+    // ControlFlow::Break, so that Item does not have to be assignable
+    auto res = details::try_fold(
+        self, Unit, [this](unit_t, Item item) -> Result<unit_t, Item> {
+            if (p(details::as_const(item))) {
+                return Err(reverse_decay(std::forward<Item>(item)));
+            }
 
-        if (p(next_opt.get_unchecked())) {
-            return std::move(next_opt);
-        }
-    }
+            return Ok(Unit);
+        });
 
-    return None;
+    return std::move(res).err();
 }
 
 template <class P>
-auto find(P &&p) -> FindOp<special_decay_t<P>> {
+RUSTFP_CONSTEXPR auto find(P &&p) -> FindOp<special_decay_t<P>> {
     return FindOp<special_decay_t<P>>(std::forward<P>(p));
 }
 } // namespace rustfp
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -64,21 +67,23 @@ operator()(Self &&self) && -> std::result_of_t<F(typename Self::Item)> {
         !std::is_lvalue_reference<Self>::value,
         "find_map can only take rvalue ref object with Iterator traits");
 
-    while (true) {
-        auto next_opt = self.next();
+    using Item = typename Self::Item;
+    using R = std::result_of_t<F(Item)>;
 
-        if (next_opt.is_none()) {
-            break;
-        }
+    // Err carries the first item mapped into Some out of the fold, so that
+    // the mapped item does not have to be assignable
+    auto res = details::try_fold(
+        self, Unit, [this](unit_t, Item item) -> Result<unit_t, R> {
+            auto mapped_opt = f(std::forward<Item>(item));
 
-        auto mapped_opt = f(std::move(next_opt).unwrap_unchecked());
+            if (mapped_opt.is_some()) {
+                return Err(std::move(mapped_opt));
+            }
 
-        if (mapped_opt.is_some()) {
-            return std::move(mapped_opt);
-        }
-    }
+            return Ok(Unit);
+        });
 
-    return None;
+    return std::move(res).err().unwrap_or(None);
 }
 
 template <class F>
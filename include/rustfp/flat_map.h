@@ -13,6 +13,7 @@
 #pragma once
 
 #include "iter.h"
+#include "iterator.h"
 #include "option.h"
 #include "traits.h"
 #include "util.h"
@@ -24,6 +25,18 @@ namespace rustfp {
 
 // declaration section
 
+namespace details {
+// sub-iterator of FlatMap for U, which is U itself if U is already a rustfp
+// iterator, an OptionIter over the item if U is an Option, a non-owning Iter
+// over the referred container if U is an lvalue reference or
+// std::reference_wrapper, otherwise IntoIter over the owned container
+template <class U, class = void>
+struct flat_map_sub_iter;
+
+template <class U>
+using flat_map_sub_iter_t = typename flat_map_sub_iter<U>::type;
+} // namespace details
+
 /**
  * impl<I, U, F> Iterator for FlatMap<I, U, F>
  * where
@@ -31,6 +44,11 @@ namespace rustfp {
  *     I: Iterator,
  *     U: IntoIterator,
  * type Item = <U as IntoIterator>::Item
+ *
+ * U can be a rustfp iterator, which is advanced where it sits, an Option,
+ * which generates its item if there is one, a reference to a container, which
+ * is iterated without copying, or an owned container, which is moved into
+ * IntoIter.
  */
 template <class Self, class F>
 class FlatMap {
@@ -45,10 +63,15 @@ public:
      */
     using U = std::result_of_t<F(typename Self::Item)>;
 
+    /**
+     * Type alias to the rustfp iterator type converted from U.
+     */
+    using SubIter = details::flat_map_sub_iter_t<U>;
+
     /**
      * Item type to generate.
      */
-    using Item = typename IntoIter<U>::Item;
+    using Item = typename SubIter::Item;
 
     /**
      * Takes in both the moved rustfp Iter instance and
@@ -68,9 +91,46 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left. Only the items left in
+     * the current sub-iterator are known, so the upper bound is None unless
+     * the underlying iterator has run out of items.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * The items left in the current sub-iterator are folded first.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * The items left in the current sub-iterator are folded first.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
 private:
+    auto make_sub_iter(typename Self::Item &&item) -> SubIter;
+
     Self self;
-    Option<IntoIter<U>> sub_self_opt;
+    Option<SubIter> sub_self_opt;
     F f;
 };
 
@@ -99,6 +159,104 @@ auto flat_map(F &&f) -> FlatMapOp<special_decay_t<F>>;
 
 // implementation section
 
+namespace details {
+template <class T>
+struct is_option : std::false_type {};
+
+template <class T>
+struct is_option<Option<T>> : std::true_type {};
+
+template <class U>
+using flat_map_ref_t = simplify_ref_t<U>;
+
+template <class U>
+using flat_map_ref_option_t = is_option<std::remove_cv_t<
+    std::remove_reference_t<flat_map_ref_t<U>>>>;
+
+// iterator over the item of Option, from Rust option::IntoIter
+template <class T>
+class OptionIter {
+public:
+    using Item = T;
+
+    explicit OptionIter(Option<T> &&opt) : opt(std::move(opt)) {
+    }
+
+    auto next() -> Option<Item> {
+        return opt.take();
+    }
+
+    auto size_hint() const -> size_hint_t {
+        return exact_size_hint(len());
+    }
+
+    auto len() const -> size_t {
+        return opt.is_some() ? 1 : 0;
+    }
+
+private:
+    Option<T> opt;
+};
+
+template <class U, class>
+struct flat_map_sub_iter {
+    using type = IntoIter<U>;
+
+    static auto convert(U &&value) -> type {
+        return into_iter(std::move(value));
+    }
+};
+
+template <class U>
+struct flat_map_sub_iter<U, std::enable_if_t<is_iterator<U>::value>> {
+    using type = U;
+
+    static auto convert(U &&value) -> type {
+        return std::move(value);
+    }
+};
+
+template <class T>
+struct flat_map_sub_iter<Option<T>> {
+    using type = OptionIter<T>;
+
+    static auto convert(Option<T> &&value) -> type {
+        return type(std::move(value));
+    }
+};
+
+// only refers to the item of the Option without copying
+template <class U>
+struct flat_map_sub_iter<
+    U,
+    std::enable_if_t<
+        flat_map_ref_option_t<U>::value
+        && std::is_lvalue_reference<flat_map_ref_t<U>>::value>> {
+
+    using type = OptionIter<decltype(
+        std::declval<flat_map_ref_t<U>>().as_ref().unwrap_unchecked())>;
+
+    static auto convert(U &&value) -> type {
+        return type(static_cast<flat_map_ref_t<U>>(value).as_ref());
+    }
+};
+
+template <class U>
+struct flat_map_sub_iter<
+    U,
+    std::enable_if_t<
+        !is_iterator<std::decay_t<U>>::value
+        && !flat_map_ref_option_t<U>::value
+        && std::is_lvalue_reference<flat_map_ref_t<U>>::value>> {
+
+    using type = iter_type_t<std::remove_reference_t<flat_map_ref_t<U>>>;
+
+    static auto convert(U &&value) -> type {
+        return iter(static_cast<flat_map_ref_t<U>>(value));
+    }
+};
+} // namespace details
+
 template <class Self, class F>
 template <class Selfx, class Fx>
 FlatMap<Self, F>::FlatMap(Selfx &&self, Fx &&f)
@@ -118,27 +276,99 @@ auto FlatMap<Self, F>::next() -> Option<Item> {
             }
 
             // load up the sub_self and retry again
-            sub_self_opt =
-                Some(into_iter(f(std::move(item_opt).unwrap_unchecked())));
+            sub_self_opt.emplace(
+                make_sub_iter(std::move(item_opt).unwrap_unchecked()));
 
             continue;
         }
 
-        auto sub_self = std::move(sub_self_opt).unwrap_unchecked();
-        auto next_opt = sub_self.next();
+        // advances the sub_self in place
+        auto next_opt = sub_self_opt.get_mut_unchecked().next();
 
         if (next_opt.is_none()) {
             sub_self_opt = None;
             continue;
         }
 
-        sub_self_opt = Some(move(sub_self));
-
         // success case
-        return std::move(next_opt);
+        return next_opt;
     }
 }
 
+template <class Self, class F>
+auto FlatMap<Self, F>::size_hint() const -> size_hint_t {
+    const auto sub_hint = sub_self_opt.is_some()
+                              ? details::size_hint(sub_self_opt.get_unchecked())
+                              : details::exact_size_hint(0);
+
+    const auto hint = details::size_hint(self);
+
+    if (hint.second.is_some() && hint.second.get_unchecked() == 0) {
+        return sub_hint;
+    }
+
+    return size_hint_t(sub_hint.first, None);
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+auto FlatMap<Self, F>::fold(Acc init, G &&g) -> Acc {
+    using SelfItem = typename Self::Item;
+
+    if (sub_self_opt.is_some()) {
+        init = details::fold(
+            sub_self_opt.get_mut_unchecked(), std::move(init), g);
+
+        sub_self_opt = None;
+    }
+
+    return details::fold(
+        self, std::move(init), [this, &g](Acc acc, SelfItem item) -> Acc {
+            auto sub_self = make_sub_iter(std::forward<SelfItem>(item));
+            return details::fold(sub_self, std::move(acc), g);
+        });
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+auto FlatMap<Self, F>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using SelfItem = typename Self::Item;
+    using R = try_fold_t<Acc, G, Item>;
+
+    if (sub_self_opt.is_some()) {
+        R res = details::try_fold(
+            sub_self_opt.get_mut_unchecked(), std::move(init), g);
+
+        if (res.is_err()) {
+            return res;
+        }
+
+        init = std::move(res).unwrap_unchecked();
+        sub_self_opt = None;
+    }
+
+    return details::try_fold(
+        self, std::move(init), [this, &g](Acc acc, SelfItem item) -> R {
+            auto sub_self = make_sub_iter(std::forward<SelfItem>(item));
+            R res = details::try_fold(sub_self, std::move(acc), g);
+
+            if (res.is_err()) {
+                // keeps the items left for the subsequent calls
+                sub_self_opt.emplace(std::move(sub_self));
+            }
+
+            return res;
+        });
+}
+
+template <class Self, class F>
+auto FlatMap<Self, F>::make_sub_iter(typename Self::Item &&item) -> SubIter {
+    return details::flat_map_sub_iter<U>::convert(
+        f(std::forward<typename Self::Item>(item)));
+}
+
 template <class F>
 template <class Fx>
 FlatMapOp<F>::FlatMapOp(Fx &&f) : f(std::forward<Fx>(f)) {
@@ -0,0 +1,83 @@
+/**
+ * Contains Rust Iterator flatten equivalent implementation.
+ *
+ * flatten function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.flatten
+ *
+ * Flatten struct: https://doc.rust-lang.org/std/iter/struct.Flatten.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "flat_map.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+namespace details {
+// returns the item as it is, so that references to containers stay as
+// references instead of being copied into IntoIter
+struct FlattenIdentity {
+    template <class T>
+    auto operator()(T &&value) const -> T;
+};
+} // namespace details
+
+/**
+ * impl<I, U> Iterator for Flatten<I>
+ * where
+ *     I: Iterator,
+ *     <I as Iterator>::Item: IntoIterator<IntoIter = U>,
+ *     U: Iterator,
+ * type Item = <U as Iterator>::Item
+ *
+ * Each item can be a rustfp iterator, an Option, a reference to a container
+ * or an owned container, which are iterated in the same way as the results of
+ * flat_map. fold and try_fold run the sub-iterators with their own fold, so
+ * nested contiguous containers are scanned with a loop over each segment.
+ */
+template <class Self>
+using Flatten = FlatMap<Self, details::FlattenIdentity>;
+
+class FlattenOp {
+public:
+    template <class Self>
+    auto operator()(Self &&self) && -> Flatten<Self>;
+};
+
+/**
+ * fn flatten(self) -> Flatten<Self>
+ * where
+ *     Self::Item: IntoIterator,
+ */
+auto flatten() -> FlattenOp;
+
+// implementation section
+
+namespace details {
+template <class T>
+auto FlattenIdentity::operator()(T &&value) const -> T {
+    return std::forward<T>(value);
+}
+} // namespace details
+
+template <class Self>
+auto FlattenOp::operator()(Self &&self) && -> Flatten<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "flatten can only take rvalue ref object with Iterator traits");
+
+    return Flatten<Self>(std::move(self), details::FlattenIdentity());
+}
+
+inline auto flatten() -> FlattenOp {
+    return FlattenOp();
+}
+} // namespace rustfp
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "traits.h"
 #include "util.h"
 
@@ -24,10 +25,10 @@ template <class B, class F>
 class FoldOp {
 public:
     template <class Bx, class Fx>
-    FoldOp(Bx &&init, Fx &&f);
+    RUSTFP_CONSTEXPR FoldOp(Bx &&init, Fx &&f);
 
     template <class Self>
-    auto operator()(Self &&self) && -> B;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> B;
 
 private:
     B init;
@@ -40,40 +41,30 @@ private:
  *     F: FnMut(B, Self::Item) -> B,
  */
 template <class B, class F>
-auto fold(B &&init, F &&f) -> FoldOp<special_decay_t<B>, special_decay_t<F>>;
+RUSTFP_CONSTEXPR auto fold(B &&init, F &&f)
+    -> FoldOp<special_decay_t<B>, special_decay_t<F>>;
 
 // implementation section
 
 template <class B, class F>
 template <class Bx, class Fx>
-FoldOp<B, F>::FoldOp(Bx &&init, Fx &&f)
+RUSTFP_CONSTEXPR FoldOp<B, F>::FoldOp(Bx &&init, Fx &&f)
     : init(std::forward<Bx>(init)), f(std::forward<Fx>(f)) {
 }
 
 template <class B, class F>
 template <class Self>
-auto FoldOp<B, F>::operator()(Self &&self) && -> B {
+RUSTFP_CONSTEXPR auto FoldOp<B, F>::operator()(Self &&self) && -> B {
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "fold can only take rvalue ref object with Iterator traits");
 
-    auto op_acc = std::move(init);
-
-    while (true) {
-        auto next_opt = self.next();
-
-        if (next_opt.is_none()) {
-            break;
-        }
-
-        op_acc = f(std::move(op_acc), std::move(next_opt).unwrap_unchecked());
-    }
-
-    return op_acc;
+    return details::fold(self, std::move(init), f);
 }
 
 template <class B, class F>
-auto fold(B &&init, F &&f) -> FoldOp<special_decay_t<B>, special_decay_t<F>> {
+RUSTFP_CONSTEXPR auto fold(B &&init, F &&f)
+    -> FoldOp<special_decay_t<B>, special_decay_t<F>> {
 
     return FoldOp<special_decay_t<B>, special_decay_t<F>>(
         std::forward<B>(init), std::forward<F>(f));
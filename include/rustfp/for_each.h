@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "unit.h"
 #include "util.h"
 
@@ -61,17 +62,12 @@ auto ForEachOp<F>::operator()(Self &&self) && -> unit_t {
         !std::is_lvalue_reference<Self>::value,
         "for_each can only take rvalue ref object with Iterator traits");
 
-    while (true) {
-        auto value_opt = self.next();
+    using Item = typename Self::Item;
 
-        if (value_opt.is_none()) {
-            break;
-        }
-
-        f(std::move(value_opt).unwrap_unchecked());
-    }
-
-    return Unit;
+    return details::fold(self, Unit, [this](unit_t, Item value) {
+        f(std::forward<Item>(value));
+        return Unit;
+    });
 }
 
 template <class F>
@@ -7,12 +7,20 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace rustfp {
 
@@ -53,9 +61,102 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left in the container. Both
+     * bounds are exact if the std iterator is random access, otherwise
+     * (0, None) is returned.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in the container in O(1). Only
+     * available if the std iterator is random access.
+     * @return Number of items left.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::const_iterator,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds. Only available if the std iterator is
+     * random access.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::const_iterator,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the iterator by n items without generating them. Takes O(1)
+     * if the std iterator is random access, otherwise O(n).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next item from the back of the container.
+     * Only available if the std iterator is bidirectional.
+     * @return Next iteration of item to be generated from the back.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::const_iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the iterator from the back by n items without generating them.
+     * Takes O(1) if the std iterator is random access, otherwise O(n).
+     * Only available if the std iterator is bidirectional.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::const_iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
 private:
-    std::reference_wrapper<const StdInputIterable> inputIterableRef;
     typename StdInputIterable::const_iterator curr_it;
+    typename StdInputIterable::const_iterator end_it;
 };
 
 /**
@@ -93,9 +194,102 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left in the container. Both
+     * bounds are exact if the std iterator is random access, otherwise
+     * (0, None) is returned.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in the container in O(1). Only
+     * available if the std iterator is random access.
+     * @return Number of items left.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds. Only available if the std iterator is
+     * random access.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the iterator by n items without generating them. Takes O(1)
+     * if the std iterator is random access, otherwise O(n).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next item from the back of the container.
+     * Only available if the std iterator is bidirectional.
+     * @return Next iteration of item to be generated from the back.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the iterator from the back by n items without generating them.
+     * Takes O(1) if the std iterator is random access, otherwise O(n).
+     * Only available if the std iterator is bidirectional.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class StdIterator = typename StdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
 private:
-    std::reference_wrapper<StdInputIterable> inputIterableRef;
     typename StdInputIterable::iterator curr_it;
+    typename StdInputIterable::iterator end_it;
 };
 
 /**
@@ -133,9 +327,90 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left in the container. Both
+     * bounds are exact if the std iterator is random access, otherwise
+     * (0, None) is returned.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in the container in O(1). Only
+     * available if the std iterator is random access.
+     * @return Number of items left.
+     */
+    template <
+        class StdIterator = typename MovedStdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the iterator by n items without generating them. Takes O(1)
+     * if the std iterator is random access, otherwise O(n).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next item from the back of the container.
+     * Only available if the std iterator is bidirectional.
+     * @return Next iteration of item to be generated from the back.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    template <
+        class StdIterator = typename MovedStdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the iterator from the back by n items without generating them.
+     * Takes O(1) if the std iterator is random access, otherwise O(n).
+     * Only available if the std iterator is bidirectional.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class StdIterator = typename MovedStdInputIterable::iterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
 private:
     MovedStdInputIterable input_iterable;
     typename MovedStdInputIterable::iterator curr_it;
+    typename MovedStdInputIterable::iterator end_it;
 };
 
 /**
@@ -172,11 +447,266 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left in the container. Both
+     * bounds are exact if the std iterator is random access, otherwise
+     * (0, None) is returned.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in the container in O(1). Only
+     * available if the std iterator is random access.
+     * @return Number of items left.
+     */
+    template <
+        class StdIterator =
+            std::common_type_t<StdBeginInputIterator, StdEndInputIterator>,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds. Only available if the std iterator is
+     * random access.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class StdIterator =
+            std::common_type_t<StdBeginInputIterator, StdEndInputIterator>,
+        class = std::enable_if_t<
+            details::is_random_access_iterator<StdIterator>::value>>
+    auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the iterator by n items without generating them. Takes O(1)
+     * if the std iterator is random access, otherwise O(n).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next item from the back of the container.
+     * Only available if the std iterator is bidirectional.
+     * @return Next iteration of item to be generated from the back.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    template <
+        class StdIterator = StdEndInputIterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the iterator from the back by n items without generating them.
+     * Takes O(1) if the std iterator is random access, otherwise O(n).
+     * Only available if the std iterator is bidirectional.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class StdIterator = StdEndInputIterator,
+        class = std::enable_if_t<
+            details::is_bidirectional_iterator<StdIterator>::value>>
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
 private:
     StdBeginInputIterator curr_it;
     StdEndInputIterator end_it;
 };
 
+/**
+ * Represents rustfp iterator type for generating references to the values in
+ * a contiguous range of memory, such as std::vector, std::array, std::string
+ * and C arrays. Only holds the pair of pointers to the range, and is selected
+ * automatically by iter, iter_mut and iter_begin_end.
+ * @tparam T Value type of the range, which is const for immutable references.
+ */
+template <class T>
+class ContiguousIter {
+public:
+    /**
+     * Type alias referencing to the reference type of the values.
+     */
+    using Item = simplify_ref_t<T &>;
+
+    /**
+     * Constructor to take in the pointers to the range.
+     * @param begin_ptr Pointer to the first value of the range.
+     * @param end_ptr Pointer to one past the last value of the range.
+     */
+    ContiguousIter(T *begin_ptr, T *end_ptr);
+
+    /**
+     * Generates the next item from the range.
+     * @return Next iteration of item to be generated.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left in the range, which is
+     * always exact.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left in the range.
+     * @return Number of items left.
+     */
+    auto len() const -> size_t;
+
+    /**
+     * Returns the pointer to the next value of the range, which allows the
+     * values left to be copied directly with len().
+     * @return Pointer to the next value.
+     */
+    auto as_ptr() const -> T *;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the iterator by n items without generating them in O(1).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next item from the back of the range.
+     * @return Next iteration of item to be generated from the back.
+     * Some(Item) if the end of iteration has not been reached,
+     * otherwise None.
+     */
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the iterator from the back by n items without generating them
+     * in O(1).
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
+private:
+    T *curr_ptr;
+    T *end_ptr;
+};
+
+namespace details {
+// std::vector<bool> is excluded since its values are not stored contiguously
+template <class StdInputIterable>
+struct is_contiguous_iterable : std::false_type {};
+
+template <class T, class Allocator>
+struct is_contiguous_iterable<std::vector<T, Allocator>> : std::true_type {};
+
+template <class Allocator>
+struct is_contiguous_iterable<std::vector<bool, Allocator>>
+    : std::false_type {};
+
+template <class T, size_t N>
+struct is_contiguous_iterable<std::array<T, N>> : std::true_type {};
+
+template <class CharT, class Traits, class Allocator>
+struct is_contiguous_iterable<std::basic_string<CharT, Traits, Allocator>>
+    : std::true_type {};
+
+template <class T, size_t N>
+struct is_contiguous_iterable<T[N]> : std::true_type {};
+
+template <class StdInputIterable>
+using contiguous_value_t = std::remove_reference_t<
+    decltype(*std::begin(std::declval<StdInputIterable &>()))>;
+
+template <class StdInputIterable>
+using iter_type_t = std::conditional_t<
+    is_contiguous_iterable<std::remove_cv_t<StdInputIterable>>::value,
+    ContiguousIter<std::add_const_t<contiguous_value_t<StdInputIterable>>>,
+    Iter<StdInputIterable>>;
+
+template <class StdInputIterable>
+using iter_mut_type_t = std::conditional_t<
+    is_contiguous_iterable<std::remove_cv_t<StdInputIterable>>::value,
+    ContiguousIter<contiguous_value_t<StdInputIterable>>,
+    IterMut<StdInputIterable>>;
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+using iter_begin_end_type_t = std::conditional_t<
+    std::is_pointer<StdBeginInputIterator>::value
+        && std::is_pointer<StdEndInputIterator>::value,
+    ContiguousIter<std::add_const_t<std::remove_pointer_t<
+        std::common_type_t<StdBeginInputIterator, StdEndInputIterator>>>>,
+    IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>>;
+} // namespace details
+
 /**
  * Wraps a container type that has std-styled iterator, into rustfp iterator
  * that generates immutable reference to the original values in the container.
@@ -184,11 +714,12 @@ private:
  * std input iterator for begin and end.
  * @param input_iterable Immutable reference of container
  * to accept for generate the items.
- * @return rustfp iterator to hold the state of both given iterators.
+ * @return rustfp iterator to hold the state of both given iterators, which
+ * is ContiguousIter if the container stores its values contiguously.
  */
 template <class StdInputIterable>
 auto iter(StdInputIterable &&input_iterable)
-    -> Iter<std::remove_reference_t<StdInputIterable>>;
+    -> details::iter_type_t<std::remove_reference_t<StdInputIterable>>;
 
 /**
  * Wraps a container type that has std-styled iterator, into rustfp iterator
@@ -197,13 +728,14 @@ auto iter(StdInputIterable &&input_iterable)
  * std input iterator for begin and end.
  * @param input_iterable Reference of container
  * to accept for generate the items.
- * @return rustfp iterator to hold the state of both given iterators.
+ * @return rustfp iterator to hold the state of both given iterators, which
+ * is ContiguousIter if the container stores its values contiguously.
  */
 template <
     class StdInputIterable,
     class = std::enable_if_t<!std::is_const<StdInputIterable>::value>>
 auto iter_mut(StdInputIterable &input_iterable)
-    -> IterMut<std::remove_reference_t<StdInputIterable>>;
+    -> details::iter_mut_type_t<std::remove_reference_t<StdInputIterable>>;
 
 /**
  * Wraps a container type that has std-styled iterator, into rustfp iterator
@@ -228,22 +760,23 @@ auto into_iter(MovedStdInputIterable &&moved_input_iterable)
  * @tparam StdEndInputIterator End iterator type.
  * @param begin_it Begin iterator of the container/array.
  * @param end_it End iterator of container/array.
- * @return rustfp iterator to hold the state of both given iterators.
+ * @return rustfp iterator to hold the state of both given iterators, which
+ * is ContiguousIter if both iterators are pointers.
  */
 template <class StdBeginInputIterator, class StdEndInputIterator>
 auto iter_begin_end(
     StdBeginInputIterator &&begin_it, StdEndInputIterator &&end_it)
-    -> IterBeginEnd<
+    -> details::iter_begin_end_type_t<
         std::remove_reference_t<StdBeginInputIterator>,
         std::remove_reference_t<StdEndInputIterator>>;
 
 // implementation section
 
 namespace details {
-template <class Item, class InputIterable, class InputIterator>
-auto next_impl(InputIterable &input_iterable, InputIterator &curr_it)
+template <class Item, class InputIterator>
+auto next_impl(InputIterator &curr_it, const InputIterator &end_it)
     -> Option<Item> {
-    if (curr_it != std::end(input_iterable)) {
+    if (curr_it != end_it) {
         const auto prev_it = curr_it;
         ++curr_it;
         return Some(std::ref(*prev_it));
@@ -251,38 +784,401 @@ auto next_impl(InputIterable &input_iterable, InputIterator &curr_it)
         return None;
     }
 }
+
+template <class Item, class InputIterator>
+auto next_back_impl(const InputIterator &curr_it, InputIterator &end_it)
+    -> Option<Item> {
+    if (curr_it != end_it) {
+        --end_it;
+        return Some(std::ref(*end_it));
+    } else {
+        return None;
+    }
+}
+
+template <
+    class Item,
+    class InputIterator,
+    class EndInputIterator,
+    class B,
+    class F>
+auto iter_fold(
+    InputIterator &curr_it, const EndInputIterator &end_it, B init, F &&f)
+    -> B {
+
+    auto acc = std::move(init);
+
+    // Item && collapses into lvalue reference for reference Item
+    // and moves the value for value Item
+    for (; curr_it != end_it; ++curr_it) {
+        acc = f(std::move(acc), static_cast<Item &&>(*curr_it));
+    }
+
+    return acc;
+}
+
+template <
+    class Item,
+    class InputIterator,
+    class EndInputIterator,
+    class B,
+    class F>
+auto iter_try_fold(
+    InputIterator &curr_it, const EndInputIterator &end_it, B init, F &&f)
+    -> try_fold_t<B, F, Item> {
+
+    auto acc = std::move(init);
+
+    while (curr_it != end_it) {
+        auto res = f(std::move(acc), static_cast<Item &&>(*curr_it));
+        ++curr_it;
+
+        if (res.is_err()) {
+            return res;
+        }
+
+        acc = std::move(res).unwrap_unchecked();
+    }
+
+    return Ok(std::move(acc));
+}
+
+template <class StdInputIterable>
+auto contiguous_data(StdInputIterable &input_iterable)
+    -> decltype(input_iterable.data()) {
+
+    return input_iterable.data();
+}
+
+// non-const data() of std::basic_string is only available since C++17
+template <class CharT, class Traits, class Allocator>
+auto contiguous_data(std::basic_string<CharT, Traits, Allocator> &input_string)
+    -> CharT * {
+
+    return &input_string[0];
+}
+
+template <class CharT, class Traits, class Allocator>
+auto contiguous_data(
+    const std::basic_string<CharT, Traits, Allocator> &input_string)
+    -> const CharT * {
+
+    return &input_string[0];
+}
+
+template <class T, size_t N>
+auto contiguous_data(T (&input_array)[N]) -> T * {
+    return input_array;
+}
+
+template <class It, class StdInputIterable>
+auto make_iter_impl(StdInputIterable &input_iterable, std::true_type) -> It {
+    const auto begin_ptr = contiguous_data(input_iterable);
+
+    return It(
+        begin_ptr,
+        begin_ptr + (std::end(input_iterable) - std::begin(input_iterable)));
+}
+
+template <class It, class StdInputIterable>
+auto make_iter_impl(StdInputIterable &input_iterable, std::false_type) -> It {
+    return It(input_iterable);
+}
+
+// constructs the rustfp iterator type selected for the container
+template <class It, class StdInputIterable>
+auto make_iter(StdInputIterable &input_iterable) -> It {
+    return make_iter_impl<It>(
+        input_iterable,
+        is_contiguous_iterable<std::remove_cv_t<StdInputIterable>>());
+}
+
+template <class Item, class InputIterator>
+auto iter_at_unchecked(const InputIterator &curr_it, const size_t i) -> Item {
+    using difference_type =
+        typename std::iterator_traits<InputIterator>::difference_type;
+
+    return static_cast<Item>(curr_it[static_cast<difference_type>(i)]);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_size_hint_impl(
+    const StdBeginInputIterator &curr_it,
+    const StdEndInputIterator &end_it,
+    std::true_type) -> size_hint_t {
+
+    return exact_size_hint(static_cast<size_t>(end_it - curr_it));
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_size_hint_impl(
+    const StdBeginInputIterator &,
+    const StdEndInputIterator &,
+    std::false_type) -> size_hint_t {
+
+    return size_hint_t(0, None);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_size_hint(
+    const StdBeginInputIterator &curr_it, const StdEndInputIterator &end_it)
+    -> size_hint_t {
+
+    // only random access iterators can compute the distance in O(1)
+    using is_random_access = std::integral_constant<
+        bool,
+        is_random_access_iterator<StdBeginInputIterator>::value
+            && is_random_access_iterator<StdEndInputIterator>::value>;
+
+    return iter_size_hint_impl(curr_it, end_it, is_random_access());
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_by_impl(
+    StdBeginInputIterator &curr_it,
+    const StdEndInputIterator &end_it,
+    const size_t n,
+    std::true_type) -> Result<unit_t, size_t> {
+
+    using difference_type =
+        typename std::iterator_traits<StdBeginInputIterator>::difference_type;
+
+    const auto step = std::min(n, static_cast<size_t>(end_it - curr_it));
+    curr_it += static_cast<difference_type>(step);
+
+    if (step < n) {
+        return Err(n - step);
+    }
+
+    return Ok(Unit);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_by_impl(
+    StdBeginInputIterator &curr_it,
+    const StdEndInputIterator &end_it,
+    const size_t n,
+    std::false_type) -> Result<unit_t, size_t> {
+
+    for (size_t i = 0; i < n; ++i) {
+        if (curr_it == end_it) {
+            return Err(n - i);
+        }
+
+        ++curr_it;
+    }
+
+    return Ok(Unit);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_by(
+    StdBeginInputIterator &curr_it,
+    const StdEndInputIterator &end_it,
+    const size_t n) -> Result<unit_t, size_t> {
+
+    // only random access iterators can jump in O(1)
+    using is_random_access = std::integral_constant<
+        bool,
+        is_random_access_iterator<StdBeginInputIterator>::value
+            && is_random_access_iterator<StdEndInputIterator>::value>;
+
+    return iter_advance_by_impl(curr_it, end_it, n, is_random_access());
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_back_by_impl(
+    const StdBeginInputIterator &curr_it,
+    StdEndInputIterator &end_it,
+    const size_t n,
+    std::true_type) -> Result<unit_t, size_t> {
+
+    using difference_type =
+        typename std::iterator_traits<StdEndInputIterator>::difference_type;
+
+    const auto step = std::min(n, static_cast<size_t>(end_it - curr_it));
+    end_it -= static_cast<difference_type>(step);
+
+    if (step < n) {
+        return Err(n - step);
+    }
+
+    return Ok(Unit);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_back_by_impl(
+    const StdBeginInputIterator &curr_it,
+    StdEndInputIterator &end_it,
+    const size_t n,
+    std::false_type) -> Result<unit_t, size_t> {
+
+    for (size_t i = 0; i < n; ++i) {
+        if (curr_it == end_it) {
+            return Err(n - i);
+        }
+
+        --end_it;
+    }
+
+    return Ok(Unit);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto iter_advance_back_by(
+    const StdBeginInputIterator &curr_it,
+    StdEndInputIterator &end_it,
+    const size_t n) -> Result<unit_t, size_t> {
+
+    // only random access iterators can jump in O(1)
+    using is_random_access = std::integral_constant<
+        bool,
+        is_random_access_iterator<StdBeginInputIterator>::value
+            && is_random_access_iterator<StdEndInputIterator>::value>;
+
+    return iter_advance_back_by_impl(curr_it, end_it, n, is_random_access());
+}
 } // namespace details
 
 template <class StdInputIterable>
 Iter<StdInputIterable>::Iter(const StdInputIterable &input_iterable)
-    : inputIterableRef(input_iterable), curr_it(std::cbegin(input_iterable)) {
+    : curr_it(std::cbegin(input_iterable)), end_it(std::cend(input_iterable)) {
 }
 
 template <class StdInputIterable>
 auto Iter<StdInputIterable>::next() -> Option<Item> {
-    return details::next_impl<Item>(inputIterableRef.get(), curr_it);
+    return details::next_impl<Item>(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+auto Iter<StdInputIterable>::size_hint() const -> size_hint_t {
+    return details::iter_size_hint(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto Iter<StdInputIterable>::len() const -> size_t {
+    return static_cast<size_t>(end_it - curr_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto Iter<StdInputIterable>::at_unchecked(const size_t i) const -> Item {
+    return details::iter_at_unchecked<Item>(curr_it, i);
+}
+
+template <class StdInputIterable>
+template <class Acc, class G>
+auto Iter<StdInputIterable>::fold(Acc init, G &&g) -> Acc {
+    return details::iter_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdInputIterable>
+template <class Acc, class G>
+auto Iter<StdInputIterable>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    return details::iter_try_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdInputIterable>
+auto Iter<StdInputIterable>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_by(curr_it, end_it, n);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto Iter<StdInputIterable>::next_back() -> Option<Item> {
+    return details::next_back_impl<Item>(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto Iter<StdInputIterable>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_back_by(curr_it, end_it, n);
 }
 
 template <class StdInputIterable>
 IterMut<StdInputIterable>::IterMut(StdInputIterable &input_iterable)
-    : inputIterableRef(input_iterable), curr_it(std::begin(input_iterable)) {
+    : curr_it(std::begin(input_iterable)), end_it(std::end(input_iterable)) {
 }
 
 template <class StdInputIterable>
 auto IterMut<StdInputIterable>::next() -> Option<Item> {
-    return details::next_impl<Item>(inputIterableRef.get(), curr_it);
+    return details::next_impl<Item>(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+auto IterMut<StdInputIterable>::size_hint() const -> size_hint_t {
+    return details::iter_size_hint(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto IterMut<StdInputIterable>::len() const -> size_t {
+    return static_cast<size_t>(end_it - curr_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto IterMut<StdInputIterable>::at_unchecked(const size_t i) const -> Item {
+    return details::iter_at_unchecked<Item>(curr_it, i);
+}
+
+template <class StdInputIterable>
+template <class Acc, class G>
+auto IterMut<StdInputIterable>::fold(Acc init, G &&g) -> Acc {
+    return details::iter_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdInputIterable>
+template <class Acc, class G>
+auto IterMut<StdInputIterable>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    return details::iter_try_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdInputIterable>
+auto IterMut<StdInputIterable>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_by(curr_it, end_it, n);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto IterMut<StdInputIterable>::next_back() -> Option<Item> {
+    return details::next_back_impl<Item>(curr_it, end_it);
+}
+
+template <class StdInputIterable>
+template <class StdIterator, class>
+auto IterMut<StdInputIterable>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_back_by(curr_it, end_it, n);
 }
 
 template <class MovedStdInputIterable>
 IntoIter<MovedStdInputIterable>::IntoIter(
     MovedStdInputIterable &&input_iterable)
     : input_iterable(std::move(input_iterable)),
-      curr_it(std::begin(this->input_iterable)) {
+      curr_it(std::begin(this->input_iterable)),
+      end_it(std::end(this->input_iterable)) {
 }
 
 template <class MovedStdInputIterable>
 auto IntoIter<MovedStdInputIterable>::next() -> Option<Item> {
-    if (curr_it != std::end(input_iterable)) {
+    if (curr_it != end_it) {
         auto prev_it = curr_it;
         ++curr_it;
         return Some(std::move(*prev_it));
@@ -291,6 +1187,59 @@ auto IntoIter<MovedStdInputIterable>::next() -> Option<Item> {
     }
 }
 
+template <class MovedStdInputIterable>
+auto IntoIter<MovedStdInputIterable>::size_hint() const -> size_hint_t {
+    return details::iter_size_hint(curr_it, end_it);
+}
+
+template <class MovedStdInputIterable>
+template <class StdIterator, class>
+auto IntoIter<MovedStdInputIterable>::len() const -> size_t {
+    return static_cast<size_t>(end_it - curr_it);
+}
+
+template <class MovedStdInputIterable>
+template <class Acc, class G>
+auto IntoIter<MovedStdInputIterable>::fold(Acc init, G &&g) -> Acc {
+    return details::iter_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class MovedStdInputIterable>
+template <class Acc, class G>
+auto IntoIter<MovedStdInputIterable>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    return details::iter_try_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class MovedStdInputIterable>
+auto IntoIter<MovedStdInputIterable>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_by(curr_it, end_it, n);
+}
+
+template <class MovedStdInputIterable>
+template <class StdIterator, class>
+auto IntoIter<MovedStdInputIterable>::next_back() -> Option<Item> {
+    if (curr_it != end_it) {
+        --end_it;
+        return Some(std::move(*end_it));
+    } else {
+        return None;
+    }
+}
+
+template <class MovedStdInputIterable>
+template <class StdIterator, class>
+auto IntoIter<MovedStdInputIterable>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_back_by(curr_it, end_it, n);
+}
+
 template <class StdBeginInputIterator, class StdEndInputIterator>
 IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::IterBeginEnd(
     StdBeginInputIterator &&begin_it, StdEndInputIterator &&end_it)
@@ -312,27 +1261,162 @@ auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::next()
     }
 }
 
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::size_hint()
+    const -> size_hint_t {
+
+    return details::iter_size_hint(curr_it, end_it);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class StdIterator, class>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::len() const
+    -> size_t {
+
+    return static_cast<size_t>(end_it - curr_it);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class StdIterator, class>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::at_unchecked(
+    const size_t i) const -> Item {
+
+    return details::iter_at_unchecked<Item>(curr_it, i);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class Acc, class G>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::fold(
+    Acc init, G &&g) -> Acc {
+
+    return details::iter_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class Acc, class G>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::try_fold(
+    Acc init, G &&g) -> try_fold_t<Acc, G, Item> {
+
+    return details::iter_try_fold<Item>(
+        curr_it, end_it, std::move(init), std::forward<G>(g));
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::advance_by(
+    const size_t n) -> Result<unit_t, size_t> {
+
+    return details::iter_advance_by(curr_it, end_it, n);
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class StdIterator, class>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::next_back()
+    -> Option<Item> {
+    if (curr_it != end_it) {
+        --end_it;
+        return Some(std::cref(*end_it));
+    } else {
+        return None;
+    }
+}
+
+template <class StdBeginInputIterator, class StdEndInputIterator>
+template <class StdIterator, class>
+auto IterBeginEnd<StdBeginInputIterator, StdEndInputIterator>::advance_back_by(
+    const size_t n) -> Result<unit_t, size_t> {
+
+    return details::iter_advance_back_by(curr_it, end_it, n);
+}
+
+template <class T>
+ContiguousIter<T>::ContiguousIter(T *begin_ptr, T *end_ptr)
+    : curr_ptr(begin_ptr), end_ptr(end_ptr) {
+}
+
+template <class T>
+auto ContiguousIter<T>::next() -> Option<Item> {
+    return details::next_impl<Item>(curr_ptr, end_ptr);
+}
+
+template <class T>
+auto ContiguousIter<T>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(len());
+}
+
+template <class T>
+auto ContiguousIter<T>::len() const -> size_t {
+    return static_cast<size_t>(end_ptr - curr_ptr);
+}
+
+template <class T>
+auto ContiguousIter<T>::as_ptr() const -> T * {
+    return curr_ptr;
+}
+
+template <class T>
+auto ContiguousIter<T>::at_unchecked(const size_t i) const -> Item {
+    return details::iter_at_unchecked<Item>(curr_ptr, i);
+}
+
+template <class T>
+template <class Acc, class G>
+auto ContiguousIter<T>::fold(Acc init, G &&g) -> Acc {
+    return details::iter_fold<Item>(
+        curr_ptr, end_ptr, std::move(init), std::forward<G>(g));
+}
+
+template <class T>
+template <class Acc, class G>
+auto ContiguousIter<T>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    return details::iter_try_fold<Item>(
+        curr_ptr, end_ptr, std::move(init), std::forward<G>(g));
+}
+
+template <class T>
+auto ContiguousIter<T>::advance_by(const size_t n) -> Result<unit_t, size_t> {
+    return details::iter_advance_by(curr_ptr, end_ptr, n);
+}
+
+template <class T>
+auto ContiguousIter<T>::next_back() -> Option<Item> {
+    return details::next_back_impl<Item>(curr_ptr, end_ptr);
+}
+
+template <class T>
+auto ContiguousIter<T>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::iter_advance_back_by(curr_ptr, end_ptr, n);
+}
+
 template <class StdInputIterable>
 auto iter(StdInputIterable &&input_iterable)
-    -> Iter<std::remove_reference_t<StdInputIterable>> {
+    -> details::iter_type_t<std::remove_reference_t<StdInputIterable>> {
 
     static_assert(
         std::is_lvalue_reference<StdInputIterable>::value,
         "rustfp::iter() must be invoked on lvalue reference only");
 
-    return Iter<std::remove_reference_t<StdInputIterable>>(input_iterable);
+    return details::make_iter<
+        details::iter_type_t<std::remove_reference_t<StdInputIterable>>>(
+        details::as_const(input_iterable));
 }
 
 template <class StdInputIterable, class>
 auto iter_mut(StdInputIterable &input_iterable)
-    -> IterMut<std::remove_reference_t<StdInputIterable>> {
+    -> details::iter_mut_type_t<std::remove_reference_t<StdInputIterable>> {
 
     static_assert(
         !std::is_const<StdInputIterable>::value,
         "rustfp::iter_mut() must be invoked on non-const lvalue reference "
         "only");
 
-    return IterMut<std::remove_reference_t<StdInputIterable>>(input_iterable);
+    return details::make_iter<
+        details::iter_mut_type_t<std::remove_reference_t<StdInputIterable>>>(
+        input_iterable);
 }
 
 template <class MovedStdInputIterable, class>
@@ -349,11 +1433,11 @@ auto into_iter(MovedStdInputIterable &&moved_input_iterable)
 template <class StdBeginInputIterator, class StdEndInputIterator>
 auto iter_begin_end(
     StdBeginInputIterator &&begin_it, StdEndInputIterator &&end_it)
-    -> IterBeginEnd<
+    -> details::iter_begin_end_type_t<
         std::remove_reference_t<StdBeginInputIterator>,
         std::remove_reference_t<StdEndInputIterator>> {
 
-    return IterBeginEnd<
+    return details::iter_begin_end_type_t<
         std::remove_reference_t<StdBeginInputIterator>,
         std::remove_reference_t<StdEndInputIterator>>(
         std::forward<StdBeginInputIterator>(begin_it),
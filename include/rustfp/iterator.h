@@ -0,0 +1,432 @@
+/**
+ * Contains the provided methods of Rust Iterator trait. Each of them is
+ * dispatched to the method of the same name on the rustfp iterator if it has
+ * one, otherwise to a default implementation that only requires next().
+ *
+ * Iterator trait: https://doc.rust-lang.org/std/iter/trait.Iterator.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "option.h"
+#include "result.h"
+#include "traits.h"
+#include "unit.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * Lower and upper bound on the number of remaining items of an iterator.
+ * Equivalent to Rust (usize, Option<usize>), where a None upper bound means
+ * that the upper bound is either unknown or larger than size_t.
+ */
+using size_hint_t = std::pair<size_t, Option<size_t>>;
+
+/**
+ * Result type of try_fold, where F: FnMut(B, Item) -> Result<B, E>.
+ * @tparam B Accumulator type
+ * @tparam F Function type to fold with
+ * @tparam Item Item type of the iterator being folded
+ */
+template <class B, class F, class Item>
+using try_fold_t = Result<
+    B,
+    typename std::result_of_t<std::remove_reference_t<F> &(B &&, Item &&)>::
+        err_t>;
+
+// implementation section
+
+namespace details {
+// fn next(&mut self) -> Option<Self::Item>, from Rust Iterator trait
+template <class Iterator, class = void>
+struct is_iterator : std::false_type {};
+
+template <class Iterator>
+struct is_iterator<
+    Iterator,
+    void_t<
+        typename Iterator::Item,
+        decltype(std::declval<Iterator &>().next())>> : std::true_type {};
+
+template <class Iterator, class = void>
+struct has_size_hint : std::false_type {};
+
+template <class Iterator>
+struct has_size_hint<
+    Iterator,
+    void_t<decltype(std::declval<const Iterator &>().size_hint())>>
+    : std::true_type {};
+
+template <class Iterator, class = void>
+struct is_exact_size : std::false_type {};
+
+// fn len(&self) -> usize, from Rust ExactSizeIterator trait
+template <class Iterator>
+struct is_exact_size<
+    Iterator,
+    void_t<decltype(std::declval<const Iterator &>().len())>>
+    : std::true_type {};
+
+template <class Iterator, class B, class F, class = void>
+struct has_fold : std::false_type {};
+
+template <class Iterator, class B, class F>
+struct has_fold<
+    Iterator,
+    B,
+    F,
+    void_t<decltype(
+        std::declval<Iterator &>().fold(std::declval<B>(), std::declval<F>()))>>
+    : std::true_type {};
+
+template <class Iterator, class B, class F, class = void>
+struct has_try_fold : std::false_type {};
+
+template <class Iterator, class B, class F>
+struct has_try_fold<
+    Iterator,
+    B,
+    F,
+    void_t<decltype(std::declval<Iterator &>().try_fold(
+        std::declval<B>(), std::declval<F>()))>> : std::true_type {};
+
+// fn next_back(&mut self) -> Option<Self::Item>, from Rust
+// DoubleEndedIterator trait
+template <class Iterator, class = void>
+struct is_double_ended : std::false_type {};
+
+template <class Iterator>
+struct is_double_ended<
+    Iterator,
+    void_t<decltype(std::declval<Iterator &>().next_back())>>
+    : std::true_type {};
+
+template <class Iterator, class = void>
+struct has_advance_by : std::false_type {};
+
+template <class Iterator>
+struct has_advance_by<
+    Iterator,
+    void_t<decltype(
+        std::declval<Iterator &>().advance_by(std::declval<size_t>()))>>
+    : std::true_type {};
+
+template <class Iterator, class = void>
+struct has_advance_back_by : std::false_type {};
+
+template <class Iterator>
+struct has_advance_back_by<
+    Iterator,
+    void_t<decltype(
+        std::declval<Iterator &>().advance_back_by(std::declval<size_t>()))>>
+    : std::true_type {};
+
+// fn at_unchecked(&mut self, i: usize) -> Self::Item, similar to Rust
+// TrustedRandomAccess trait, which returns the item at offset i from the front
+// without advancing. Such iterators must also be exact size and be able to
+// advance past the items taken.
+template <class Iterator, class = void>
+struct is_trusted_random_access : std::false_type {};
+
+template <class Iterator>
+struct is_trusted_random_access<
+    Iterator,
+    void_t<decltype(
+        std::declval<Iterator &>().at_unchecked(std::declval<size_t>()))>>
+    : std::integral_constant<
+          bool,
+          is_exact_size<Iterator>::value && has_advance_by<Iterator>::value> {
+};
+
+// fn as_ptr(&self) -> *const T, from Rust slice Iter, which allows the items
+// left to be read directly from memory with len()
+template <class Iterator, class = void>
+struct is_contiguous : std::false_type {};
+
+template <class Iterator>
+struct is_contiguous<
+    Iterator,
+    void_t<decltype(std::declval<const Iterator &>().as_ptr())>>
+    : is_exact_size<Iterator> {};
+
+template <class StdIterator>
+struct is_bidirectional_iterator
+    : std::is_base_of<
+          std::bidirectional_iterator_tag,
+          typename std::iterator_traits<StdIterator>::iterator_category> {};
+
+template <class StdIterator>
+struct is_random_access_iterator
+    : std::is_base_of<
+          std::random_access_iterator_tag,
+          typename std::iterator_traits<StdIterator>::iterator_category> {};
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto size_hint_impl(const Iterator &it, std::true_type)
+    -> size_hint_t {
+
+    return it.size_hint();
+}
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto size_hint_impl(const Iterator &, std::false_type)
+    -> size_hint_t {
+
+    return size_hint_t(0, None);
+}
+
+/**
+ * fn size_hint(&self) -> (usize, Option<usize>)
+ *
+ * Defaults to (0, None) if the iterator does not provide its own size_hint.
+ */
+template <class Iterator>
+RUSTFP_CONSTEXPR auto size_hint(const Iterator &it) -> size_hint_t {
+    return size_hint_impl(it, has_size_hint<Iterator>());
+}
+
+inline RUSTFP_CONSTEXPR auto exact_size_hint(const size_t len) -> size_hint_t {
+    return size_hint_t(len, Some(len));
+}
+
+// None upper bound is treated as infinity
+inline RUSTFP_CONSTEXPR auto min_upper(
+    const Option<size_t> &lhs, const Option<size_t> &rhs) -> Option<size_t> {
+
+    if (lhs.is_none()) {
+        return rhs;
+    }
+
+    if (rhs.is_none()) {
+        return lhs;
+    }
+
+    return Some(std::min(lhs.get_unchecked(), rhs.get_unchecked()));
+}
+
+inline RUSTFP_CONSTEXPR auto saturating_sub(const size_t lhs, const size_t rhs)
+    -> size_t {
+
+    return lhs > rhs ? lhs - rhs : 0;
+}
+
+inline RUSTFP_CONSTEXPR auto div_ceil(const size_t lhs, const size_t rhs)
+    -> size_t {
+
+    return lhs / rhs + (lhs % rhs != 0 ? 1 : 0);
+}
+
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto fold_impl(Iterator &it, B init, F &&f, std::true_type)
+    -> B {
+
+    return it.fold(std::move(init), std::forward<F>(f));
+}
+
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto fold_impl(Iterator &it, B init, F &&f, std::false_type)
+    -> B {
+
+    auto acc = std::move(init);
+
+    while (true) {
+        auto next_opt = it.next();
+
+        if (next_opt.is_none()) {
+            break;
+        }
+
+        acc = f(std::move(acc), std::move(next_opt).unwrap_unchecked());
+    }
+
+    return acc;
+}
+
+/**
+ * fn fold<B, F>(self, init: B, f: F) -> B
+ * where
+ *     F: FnMut(B, Self::Item) -> B,
+ *
+ * Defaults to the next() loop if the iterator does not provide its own fold.
+ */
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto fold(Iterator &it, B init, F &&f) -> B {
+    return fold_impl(
+        it, std::move(init), std::forward<F>(f), has_fold<Iterator, B, F>());
+}
+
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto try_fold_impl(Iterator &it, B init, F &&f, std::true_type)
+    -> try_fold_t<B, F, typename Iterator::Item> {
+
+    return it.try_fold(std::move(init), std::forward<F>(f));
+}
+
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto try_fold_impl(
+    Iterator &it, B init, F &&f, std::false_type)
+    -> try_fold_t<B, F, typename Iterator::Item> {
+
+    auto acc = std::move(init);
+
+    while (true) {
+        auto next_opt = it.next();
+
+        if (next_opt.is_none()) {
+            break;
+        }
+
+        auto res = f(std::move(acc), std::move(next_opt).unwrap_unchecked());
+
+        if (res.is_err()) {
+            return res;
+        }
+
+        acc = std::move(res).unwrap_unchecked();
+    }
+
+    return Ok(std::move(acc));
+}
+
+/**
+ * fn try_fold<B, F, R>(&mut self, init: B, f: F) -> R
+ * where
+ *     F: FnMut(B, Self::Item) -> R,
+ *     R: Try<Ok = B>,
+ *
+ * R is fixed to Result<B, E>, and the folding stops at the first Err.
+ * Defaults to the next() loop if the iterator does not provide its own
+ * try_fold.
+ */
+template <class Iterator, class B, class F>
+RUSTFP_CONSTEXPR auto try_fold(Iterator &it, B init, F &&f)
+    -> try_fold_t<B, F, typename Iterator::Item> {
+
+    return try_fold_impl(
+        it,
+        std::move(init),
+        std::forward<F>(f),
+        has_try_fold<Iterator, B, F>());
+}
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_by_impl(
+    Iterator &it, const size_t n, std::true_type) -> Result<unit_t, size_t> {
+
+    return it.advance_by(n);
+}
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_by_impl(
+    Iterator &it, const size_t n, std::false_type) -> Result<unit_t, size_t> {
+
+    for (size_t i = 0; i < n; ++i) {
+        if (it.next().is_none()) {
+            return Err(n - i);
+        }
+    }
+
+    return Ok(Unit);
+}
+
+/**
+ * fn advance_by(&mut self, n: usize) -> Result<(), NonZeroUsize>
+ *
+ * Err holds the number of steps that could not be advanced because the
+ * iterator ran out of items. Defaults to calling next() n times if the
+ * iterator does not provide its own advance_by.
+ */
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_by(Iterator &it, const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return advance_by_impl(it, n, has_advance_by<Iterator>());
+}
+
+/**
+ * fn nth(&mut self, n: usize) -> Option<Self::Item>
+ *
+ * Skips the first n items via advance_by.
+ */
+template <class Iterator>
+RUSTFP_CONSTEXPR auto nth(Iterator &it, const size_t n)
+    -> Option<typename Iterator::Item> {
+
+    if (advance_by(it, n).is_err()) {
+        return None;
+    }
+
+    return it.next();
+}
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_back_by_impl(
+    Iterator &it, const size_t n, std::true_type) -> Result<unit_t, size_t> {
+
+    return it.advance_back_by(n);
+}
+
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_back_by_impl(
+    Iterator &it, const size_t n, std::false_type) -> Result<unit_t, size_t> {
+
+    for (size_t i = 0; i < n; ++i) {
+        if (it.next_back().is_none()) {
+            return Err(n - i);
+        }
+    }
+
+    return Ok(Unit);
+}
+
+/**
+ * fn advance_back_by(&mut self, n: usize) -> Result<(), NonZeroUsize>
+ *
+ * Same as advance_by, but from the back of a double-ended iterator. Defaults
+ * to calling next_back() n times if the iterator does not provide its own
+ * advance_back_by.
+ */
+template <class Iterator>
+RUSTFP_CONSTEXPR auto advance_back_by(Iterator &it, const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return advance_back_by_impl(it, n, has_advance_back_by<Iterator>());
+}
+
+// unwraps the accumulator of a fold that breaks early via Err
+template <class B>
+RUSTFP_CONSTEXPR auto unwrap_either(Result<B, B> &&res) -> B {
+    return res.is_ok() ? std::move(res).unwrap_unchecked()
+                       : std::move(res).unwrap_err_unchecked();
+}
+
+// unwraps the result of a try_fold that breaks early via Err(Ok(acc))
+template <class B, class E>
+RUSTFP_CONSTEXPR auto unwrap_break(Result<B, Result<B, E>> &&res)
+    -> Result<B, E> {
+
+    if (res.is_ok()) {
+        return Ok(std::move(res).unwrap_unchecked());
+    } else {
+        return std::move(res).unwrap_err_unchecked();
+    }
+}
+
+// same as Option::get_unchecked for an item to be passed into predicates
+template <class T>
+RUSTFP_CONSTEXPR auto as_const(const T &value) -> const T & {
+    return value;
+}
+} // namespace details
+} // namespace rustfp
@@ -0,0 +1,231 @@
+/**
+ * Contains the error type whose message is only formatted when it is read.
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "specs.h"
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+namespace details {
+struct LazyErrorOps;
+} // namespace details
+
+/**
+ * Error type with a static code and a deferred formatter of its message, so
+ * that errors discarded by unwrap_or, or_else or ok never get to format their
+ * messages. The formatter is stored inline within the error, hence no
+ * allocation takes place unless message is called.
+ *
+ * The error is usually returned out of the function that created it, so
+ * everything captured by the formatter must stay valid for the lifetime of
+ * the error. Capture small values by copy, or pointers to static data, and
+ * never references to locals of the creating function.
+ */
+class LazyError {
+public:
+    /**
+     * Number of bytes available to store the formatter inline, which is
+     * enough for a closure capturing up to three pointer-sized values.
+     */
+    static constexpr size_t BUFFER_LEN = 3 * sizeof(void *);
+
+    /**
+     * Creates the error with only the code, which is also its message.
+     * @param code Static string of the error code, which must outlive the
+     * error
+     */
+    explicit LazyError(const char *code) RUSTFP_NOEXCEPT;
+
+    /**
+     * Creates the error with the code and the formatter of its message.
+     * @tparam F Formatter type, where F: () -> std::string, which must fit
+     * within BUFFER_LEN bytes, be nothrow move constructible, and only
+     * capture what stays valid for the lifetime of the error
+     * @param code Static string of the error code, which must outlive the
+     * error
+     * @param fmt Formatter to call only when the message is read
+     */
+    template <class F>
+    LazyError(const char *code, F &&fmt) RUSTFP_NOEXCEPT_EXPR(
+        (std::is_nothrow_constructible<std::decay_t<F>, F &&>::value));
+
+    LazyError(const LazyError &rhs);
+    LazyError(LazyError &&rhs) RUSTFP_NOEXCEPT;
+    ~LazyError();
+
+    auto operator=(const LazyError &rhs) -> LazyError &;
+    auto operator=(LazyError &&rhs) RUSTFP_NOEXCEPT -> LazyError &;
+
+    /**
+     * Returns the static code of the error, which never formats nor
+     * allocates.
+     * @return Static string of the error code
+     */
+    auto code() const RUSTFP_NOEXCEPT -> const char *;
+
+    /**
+     * Formats the message of the error by calling the formatter, or returns
+     * the code if there is no formatter. This is the only member that
+     * allocates.
+     * @return Formatted message of the error
+     */
+    auto message() const -> std::string;
+
+private:
+    auto copy_from(const LazyError &rhs) -> void;
+    auto move_from(LazyError &rhs) RUSTFP_NOEXCEPT -> void;
+    auto destroy() RUSTFP_NOEXCEPT -> void;
+
+    const char *static_code;
+    const details::LazyErrorOps *ops;
+    std::aligned_storage_t<BUFFER_LEN, alignof(void *)> buffer;
+};
+
+// implementation section
+
+namespace details {
+// type-erased operations on the formatter stored within LazyError, which is
+// null if there is no formatter
+struct LazyErrorOps {
+    auto (*copy)(void *dst, const void *src) -> void;
+    auto (*move)(void *dst, void *src) -> void;
+    auto (*destroy)(void *fmt) -> void;
+    auto (*format)(const void *fmt) -> std::string;
+};
+
+template <class F>
+struct LazyErrorOpsImpl {
+    static auto copy(void *dst, const void *src) -> void {
+        ::new (dst) F(*static_cast<const F *>(src));
+    }
+
+    static auto move(void *dst, void *src) -> void {
+        ::new (dst) F(std::move(*static_cast<F *>(src)));
+    }
+
+    static auto destroy(void *fmt) -> void {
+        static_cast<F *>(fmt)->~F();
+    }
+
+    static auto format(const void *fmt) -> std::string {
+        return (*static_cast<const F *>(fmt))();
+    }
+
+    static const LazyErrorOps value;
+};
+
+template <class F>
+const LazyErrorOps LazyErrorOpsImpl<F>::value = {
+    &LazyErrorOpsImpl<F>::copy,
+    &LazyErrorOpsImpl<F>::move,
+    &LazyErrorOpsImpl<F>::destroy,
+    &LazyErrorOpsImpl<F>::format};
+} // namespace details
+
+inline LazyError::LazyError(const char *code) RUSTFP_NOEXCEPT
+    : static_code(code),
+      ops(nullptr) {
+}
+
+template <class F>
+LazyError::LazyError(const char *code, F &&fmt) RUSTFP_NOEXCEPT_EXPR(
+    (std::is_nothrow_constructible<std::decay_t<F>, F &&>::value))
+    : static_code(code),
+      ops(&details::LazyErrorOpsImpl<std::decay_t<F>>::value) {
+
+    using fmt_t = std::decay_t<F>;
+
+    static_assert(
+        sizeof(fmt_t) <= BUFFER_LEN && alignof(fmt_t) <= alignof(void *),
+        "LazyError formatter must fit within LazyError::BUFFER_LEN bytes, "
+        "capture only small values or pointers to static data that stay "
+        "valid for the lifetime of the error");
+
+    static_assert(
+        std::is_nothrow_move_constructible<fmt_t>::value,
+        "LazyError formatter must be nothrow move constructible");
+
+    ::new (static_cast<void *>(&buffer)) fmt_t(std::forward<F>(fmt));
+}
+
+inline LazyError::LazyError(const LazyError &rhs)
+    : static_code(rhs.static_code),
+      ops(nullptr) {
+
+    copy_from(rhs);
+}
+
+inline LazyError::LazyError(LazyError &&rhs) RUSTFP_NOEXCEPT
+    : static_code(rhs.static_code),
+      ops(nullptr) {
+
+    move_from(rhs);
+}
+
+inline LazyError::~LazyError() {
+    destroy();
+}
+
+inline auto LazyError::operator=(const LazyError &rhs) -> LazyError & {
+    if (this != &rhs) {
+        destroy();
+        static_code = rhs.static_code;
+        copy_from(rhs);
+    }
+
+    return *this;
+}
+
+inline auto LazyError::operator=(LazyError &&rhs) RUSTFP_NOEXCEPT
+    -> LazyError & {
+
+    if (this != &rhs) {
+        destroy();
+        static_code = rhs.static_code;
+        move_from(rhs);
+    }
+
+    return *this;
+}
+
+inline auto LazyError::code() const RUSTFP_NOEXCEPT -> const char * {
+    return static_code;
+}
+
+inline auto LazyError::message() const -> std::string {
+    return ops ? ops->format(&buffer) : std::string(static_code);
+}
+
+inline auto LazyError::copy_from(const LazyError &rhs) -> void {
+    if (rhs.ops) {
+        rhs.ops->copy(&buffer, &rhs.buffer);
+        ops = rhs.ops;
+    }
+}
+
+inline auto LazyError::move_from(LazyError &rhs) RUSTFP_NOEXCEPT -> void {
+    if (rhs.ops) {
+        rhs.ops->move(&buffer, &rhs.buffer);
+        ops = rhs.ops;
+    }
+}
+
+inline auto LazyError::destroy() RUSTFP_NOEXCEPT -> void {
+    if (ops) {
+        ops->destroy(&buffer);
+        ops = nullptr;
+    }
+}
+} // namespace rustfp
@@ -13,12 +13,12 @@
 #include <utility>
 
 #include "result.h"
+#include "specs.h"
 #include "traits.h"
 
 #define __RUSTFP_RET_IF_ERR_IMPL(r)                                            \
-    if (r.is_err()) {                                                          \
-        return ::rustfp::Err(                                                  \
-            ::rustfp::reverse_decay(::std::move(r).unwrap_err_unchecked()));   \
+    if (RUSTFP_UNLIKELY(r.is_err())) {                                         \
+        return ::rustfp::details::forward_err(::std::move(r));                 \
     }
 
 #define __RUSTFP_RET_IF_ERR(res)                                               \
@@ -12,8 +12,11 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
 #include <type_traits>
@@ -57,14 +60,107 @@ public:
      * @param f Function type F instance
      */
     template <class Selfx, class Fx>
-    Map(Selfx &&self, Fx &&f);
+    RUSTFP_CONSTEXPR Map(Selfx &&self, Fx &&f);
 
     /**
      * Generates the next value of map operation.
      * @return Some(Item) if there is a next value to generate,
      * otherwise None.
      */
-    auto next() -> Option<Item>;
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, which is the same as the
+     * underlying iterator.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, which is the same as the
+     * underlying iterator. Only available if the underlying iterator is exact
+     * size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Returns the item at offset i from the front without advancing the
+     * iterator or checking the bounds, by mapping the item at the same offset
+     * of the underlying iterator.
+     * Only available if the underlying iterator supports at_unchecked.
+     * @param i Offset of the item, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_trusted_random_access<S>::value>>
+    RUSTFP_CONSTEXPR auto at_unchecked(const size_t i) -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the underlying iterator by n items without generating them.
+     * f is not called on the items advanced over.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value of map operation from the back.
+     * Only available if the underlying iterator is double-ended.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_double_ended<S>::value>>
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the underlying iterator from the back by n items without
+     * generating them. f is not called on the items
+     * advanced over. Only available if the underlying iterator is
+     * double-ended.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_double_ended<S>::value>>
+    RUSTFP_CONSTEXPR auto advance_back_by(const size_t n)
+        -> Result<unit_t, size_t>;
 
 private:
     Self self;
@@ -75,10 +171,10 @@ template <class F>
 class MapOp {
 public:
     template <class Fx>
-    explicit MapOp(Fx &&f);
+    RUSTFP_CONSTEXPR explicit MapOp(Fx &&f);
 
     template <class Self>
-    auto operator()(Self &&self) && -> Map<Self, F>;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> Map<Self, F>;
 
 private:
     F f;
@@ -90,31 +186,133 @@ private:
  *     F: FnMut(Self::Item) -> B,
  */
 template <class F>
-auto map(F &&f) -> MapOp<special_decay_t<F>>;
+RUSTFP_CONSTEXPR auto map(F &&f) -> MapOp<special_decay_t<F>>;
 
 // implementation section
 
+namespace details {
+// applies f on each item before passing it to g, as a function object instead
+// of a lambda so that Map can be folded in constant expressions before C++17
+template <class Acc, class SelfItem, class Item, class F, class G>
+class MapFoldFn {
+public:
+    RUSTFP_CONSTEXPR MapFoldFn(F &f, G &g) RUSTFP_NOEXCEPT : f(&f), g(&g) {
+    }
+
+    RUSTFP_CONSTEXPR auto operator()(Acc acc, SelfItem item) const
+        -> std::result_of_t<G &(Acc &&, Item &&)> {
+
+        return (*g)(
+            std::move(acc),
+            static_cast<Item>((*f)(std::forward<SelfItem>(item))));
+    }
+
+private:
+    F *f;
+    G *g;
+};
+} // namespace details
+
 template <class Self, class F>
 template <class Selfx, class Fx>
-Map<Self, F>::Map(Selfx &&self, Fx &&f)
+RUSTFP_CONSTEXPR Map<Self, F>::Map(Selfx &&self, Fx &&f)
     : self(std::forward<Selfx>(self)), f(std::forward<Fx>(f)) {
 }
 
 template <class Self, class F>
-auto Map<Self, F>::next() -> Option<Item> {
-    return self.next().map([this](auto &&value) {
-        return f(std::forward<typename Self::Item>(value));
-    });
+RUSTFP_CONSTEXPR auto Map<Self, F>::next() -> Option<Item> {
+    auto next_opt = self.next();
+
+    if (next_opt.is_none()) {
+        return None;
+    }
+
+    // constructs the mapped item directly within the returned Option
+    return Option<Item>(
+        details::invoke_tag_t{}, f, std::move(next_opt).unwrap_unchecked());
+}
+
+template <class Self, class F>
+RUSTFP_CONSTEXPR auto Map<Self, F>::size_hint() const -> size_hint_t {
+    return details::size_hint(self);
+}
+
+template <class Self, class F>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Map<Self, F>::len() const -> size_t {
+    return self.len();
+}
+
+template <class Self, class F>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Map<Self, F>::at_unchecked(const size_t i) -> Item {
+    return static_cast<Item>(f(self.at_unchecked(i)));
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Map<Self, F>::fold(Acc init, G &&g) -> Acc {
+    using fold_fn_t = details::MapFoldFn<
+        Acc,
+        typename Self::Item,
+        Item,
+        F,
+        std::remove_reference_t<G>>;
+
+    return details::fold(self, std::move(init), fold_fn_t(f, g));
+}
+
+template <class Self, class F>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Map<Self, F>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using fold_fn_t = details::MapFoldFn<
+        Acc,
+        typename Self::Item,
+        Item,
+        F,
+        std::remove_reference_t<G>>;
+
+    return details::try_fold(self, std::move(init), fold_fn_t(f, g));
+}
+
+template <class Self, class F>
+RUSTFP_CONSTEXPR auto Map<Self, F>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::advance_by(self, n);
+}
+
+template <class Self, class F>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Map<Self, F>::next_back() -> Option<Item> {
+    auto next_opt = self.next_back();
+
+    if (next_opt.is_none()) {
+        return None;
+    }
+
+    return Option<Item>(
+        details::invoke_tag_t{}, f, std::move(next_opt).unwrap_unchecked());
+}
+
+template <class Self, class F>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Map<Self, F>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    return details::advance_back_by(self, n);
 }
 
 template <class F>
 template <class Fx>
-MapOp<F>::MapOp(Fx &&f) : f(std::forward<Fx>(f)) {
+RUSTFP_CONSTEXPR MapOp<F>::MapOp(Fx &&f) : f(std::forward<Fx>(f)) {
 }
 
 template <class F>
 template <class Self>
-auto MapOp<F>::operator()(Self &&self) && -> Map<Self, F> {
+RUSTFP_CONSTEXPR auto MapOp<F>::operator()(Self &&self) && -> Map<Self, F> {
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "map can only take rvalue ref object wselfh Self traselfs");
@@ -123,7 +321,7 @@ auto MapOp<F>::operator()(Self &&self) && -> Map<Self, F> {
 }
 
 template <class F>
-auto map(F &&f) -> MapOp<special_decay_t<F>> {
+RUSTFP_CONSTEXPR auto map(F &&f) -> MapOp<special_decay_t<F>> {
     return MapOp<special_decay_t<F>>(std::forward<F>(f));
 }
 } // namespace rustfp
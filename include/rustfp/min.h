@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
 #include "traits.h"
 #include "util.h"
@@ -74,31 +75,26 @@ auto MinByOp<F>::operator()(Self &&self) && -> Option<typename Self::Item> {
         "min_by can only take rvalue ref object with Iterator traits");
 
     using Item = typename Self::Item;
-    auto min_opt = Option<Item>(None);
 
-    while (true) {
-        auto next_opt = self.next();
+    return details::fold(
+        self,
+        Option<Item>(None),
+        [this](Option<Item> min_opt, Item item) -> Option<Item> {
+            auto rhs = reverse_decay(std::forward<Item>(item));
 
-        if (next_opt.is_none()) {
-            break;
-        }
+            if (min_opt.is_none()) {
+                return Some(std::move(rhs));
+            }
 
-        if (min_opt.is_some()) {
             auto lhs = reverse_decay(std::move(min_opt).unwrap_unchecked());
-            auto rhs = reverse_decay(std::move(next_opt).unwrap_unchecked());
 
             // Some will automatically perform special decay
             if (f(special_decay(lhs), special_decay(rhs))) {
-                min_opt = Some(lhs);
-            } else {
-                min_opt = Some(rhs);
+                return Some(std::move(lhs));
             }
-        } else {
-            min_opt = std::move(next_opt);
-        }
-    }
 
-    return std::move(min_opt);
+            return Some(std::move(rhs));
+        });
 }
 
 template <class Self>
@@ -0,0 +1,58 @@
+/**
+ * Contains Rust Iterator nth equivalent implementation.
+ *
+ * nth function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.nth
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "util.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+class NthOp {
+public:
+    explicit NthOp(const size_t n);
+
+    template <class Self>
+    auto operator()(Self &&self) && -> Option<typename Self::Item>;
+
+private:
+    size_t n;
+};
+
+/**
+ * fn nth(&mut self, n: usize) -> Option<Self::Item>
+ */
+auto nth(const size_t n) -> NthOp;
+
+// implementation section
+
+inline NthOp::NthOp(const size_t n) : n(n) {
+}
+
+template <class Self>
+auto NthOp::operator()(Self &&self) && -> Option<typename Self::Item> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "nth can only take rvalue ref object with Iterator traits");
+
+    return details::nth(self, n);
+}
+
+inline auto nth(const size_t n) -> NthOp {
+    return NthOp(n);
+}
+} // namespace rustfp
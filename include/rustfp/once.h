@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
 #include "traits.h"
 
@@ -54,6 +55,18 @@ public:
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left, which is always exact.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left.
+     * @return Number of items left.
+     */
+    auto len() const -> size_t;
+
 private:
     Option<T> value;
 };
@@ -73,7 +86,17 @@ Once<T>::Once(Tx &&value) : value(Some(std::forward<Tx>(value))) {
 
 template <class T>
 auto Once<T>::next() -> Option<Item> {
-    return std::move(value);
+    return value.take();
+}
+
+template <class T>
+auto Once<T>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(value.is_some() ? 1 : 0);
+}
+
+template <class T>
+auto Once<T>::len() const -> size_t {
+    return value.is_some() ? 1 : 0;
 }
 
 template <class T>
@@ -10,12 +10,16 @@
 #pragma once
 
 #include "option_fwd.h"
+#include "option_niche.h"
 #include "result_fwd.h"
 #include "traits.h"
 #include "unit.h"
 
 #include "nonstd/optional.hpp"
 
+#include <cassert>
+#include <functional>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -26,7 +30,56 @@ namespace rustfp {
 namespace details {
 template <class T>
 class SomeImpl;
-}
+
+template <class Storage>
+class OptionResetOnMove;
+
+template <class T>
+class OptionTrivialStorage;
+
+template <class T>
+class OptionRefStorage;
+
+template <class T>
+class OptionNicheStorage;
+
+template <class T>
+struct option_trivial_impl
+    : std::integral_constant<
+          bool,
+          std::is_trivially_copyable<T>::value
+              && std::is_trivially_destructible<T>::value
+              && std::is_copy_constructible<T>::value
+              && !std::is_const<T>::value> {};
+
+// Option<T> is stored as T alone if T has a sentinel value declared via
+// option_niche<T>, and is trivially copyable if T is. Only the non-trivially
+// copyable storages reset the moved-from value to None.
+template <class T>
+struct option_storage_impl {
+    using value_type = std::conditional_t<
+        option_niche<T>::value && !std::is_const<T>::value,
+        OptionNicheStorage<T>,
+        std::conditional_t<
+            option_trivial_impl<T>::value,
+            OptionTrivialStorage<T>,
+            nonstd::optional_lite::optional<T>>>;
+
+    using type = std::conditional_t<
+        option_trivial_impl<T>::value,
+        value_type,
+        OptionResetOnMove<value_type>>;
+};
+
+// Option<T &> is stored as a single nullable pointer
+template <class T>
+struct option_storage_impl<T &> {
+    using type = OptionRefStorage<T>;
+};
+
+template <class T>
+using option_storage_t = typename option_storage_impl<T>::type;
+} // namespace details
 
 /**
  * Simulates the Rust Option enum. Wraps a value or reference in a nullable
@@ -43,7 +96,7 @@ class Option {
     friend class Option;
 
 private:
-    using optional_t = nonstd::optional_lite::optional<reverse_decay_t<T>>;
+    using optional_t = details::option_storage_t<T>;
 
 public:
     /**
@@ -66,8 +119,7 @@ public:
      * Copy constructor to target RHS Option.
      * @param RHS option to be copy constructed from.
      */
-    RUSTFP_CONSTEXPR Option(const Option<T> &rhs) RUSTFP_NOEXCEPT_EXPR(
-        std::is_nothrow_copy_constructible<optional_t>::value);
+    Option(const Option<T> &rhs) = default;
 
     /**
      * Copy constructor template to target RHS Option.
@@ -79,11 +131,12 @@ public:
         std::is_nothrow_copy_constructible<optional_t>::value);
 
     /**
-     * Move constructor to target RHS moving Option.
+     * Move constructor to target RHS moving Option. RHS becomes None unless
+     * T is a reference type or trivially copyable, in which case Option is
+     * trivially copyable and RHS is left unchanged.
      * @param RHS option to be move constructed from.
      */
-    RUSTFP_CONSTEXPR Option(Option<T> &&rhs) RUSTFP_NOEXCEPT_EXPR(
-        std::is_nothrow_move_constructible<optional_t>::value);
+    Option(Option<T> &&rhs) = default;
 
     /**
      * Move constructor template to target RHS moving Option.
@@ -106,6 +159,26 @@ public:
     RUSTFP_CONSTEXPR Option(const none_t &) RUSTFP_NOEXCEPT_EXPR(
         std::is_nothrow_default_constructible<optional_t>::value);
 
+    /**
+     * Constructor to construct the item in place from the given arguments,
+     * without any intermediate move. Prefer make_some over calling this
+     * directly.
+     * @param args Arguments to construct T with
+     * @see make_some
+     */
+    template <class... Args>
+    RUSTFP_CONSTEXPR explicit Option(details::some_tag_t, Args &&... args);
+
+    /**
+     * Constructor to construct the item in place from the result of invoking
+     * f with the given arguments, which avoids any move of the result from
+     * C++17 onwards, unless T is stored in nonstd::optional.
+     * @param f Function to invoke, whose result must be convertible to T
+     * @param args Arguments to invoke f with
+     */
+    template <class F, class... Args>
+    RUSTFP_CONSTEXPR Option(details::invoke_tag_t, F &&f, Args &&... args);
+
     /**
      * Assignment to take in the Some wrapped item and the assigned instance
      * is_some() will return true.
@@ -114,13 +187,14 @@ public:
      * @see is_some
      */
     template <class Tx>
-    auto operator=(details::SomeImpl<Tx> &&value) -> Option<T> &;
+    RUSTFP_CONSTEXPR auto operator=(details::SomeImpl<Tx> &&value)
+        -> Option<T> &;
 
     /**
      * Copy assignment to target RHS Option.
      * @param RHS option to be copy assigned from.
      */
-    auto operator=(const Option<T> &rhs) -> Option<T> &;
+    auto operator=(const Option<T> &rhs) -> Option<T> & = default;
 
     /**
      * Copy assignment template to target RHS Option.
@@ -128,13 +202,15 @@ public:
      * convertible to T.
      */
     template <class Tx>
-    auto operator=(const Option<Tx> &rhs) -> Option<T> &;
+    RUSTFP_CONSTEXPR auto operator=(const Option<Tx> &rhs) -> Option<T> &;
 
     /**
-     * Move assignment to target RHS Option.
+     * Move assignment to target RHS Option. RHS becomes None unless T is a
+     * reference type or trivially copyable, in which case RHS is left
+     * unchanged.
      * @param RHS option to be move assigned from.
      */
-    auto operator=(Option<T> &&rhs) -> Option<T> &;
+    auto operator=(Option<T> &&rhs) -> Option<T> & = default;
 
     /**
      * Move assignment template to target RHS Option.
@@ -142,7 +218,7 @@ public:
      * convertible to T.
      */
     template <class Tx>
-    auto operator=(Option<Tx> &&rhs) -> Option<T> &;
+    RUSTFP_CONSTEXPR auto operator=(Option<Tx> &&rhs) -> Option<T> &;
 
     /**
      * Assignment to take in None value and the assigned instance is_none() will
@@ -153,7 +229,7 @@ public:
      * creating another none_t value type.
      * @see is_none
      */
-    auto operator=(const none_t &) -> Option<T> &;
+    RUSTFP_CONSTEXPR auto operator=(const none_t &) -> Option<T> &;
 
     /**
      * Returns a lvalue const reference to the contained item.
@@ -193,7 +269,7 @@ public:
      * @see is_some
      * @see is_none
      */
-    auto unwrap_unchecked() && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_unchecked() && -> T;
 
     /**
      * Matches the corresponding function to invoke depending on whether
@@ -213,7 +289,8 @@ public:
      * @see is_none
      */
     template <class SomeFn, class NoneFn>
-    auto match(SomeFn &&some_fn, NoneFn &&none_fn) && -> std::common_type_t<
+    RUSTFP_CONSTEXPR auto
+    match(SomeFn &&some_fn, NoneFn &&none_fn) && -> std::common_type_t<
         std::result_of_t<SomeFn(some_t)>,
         std::result_of_t<NoneFn()>>;
 
@@ -236,7 +313,7 @@ public:
      * @see is_none
      */
     template <class SomeFn, class NoneFn>
-    auto
+    RUSTFP_CONSTEXPR auto
     match(SomeFn &&some_fn, NoneFn &&none_fn) const & -> std::common_type_t<
         std::result_of_t<SomeFn(const some_t &)>,
         std::result_of_t<NoneFn()>>;
@@ -253,7 +330,7 @@ public:
      * @see is_none
      */
     template <class SomeFn>
-    auto match_some(SomeFn &&some_fn) && -> unit_t;
+    RUSTFP_CONSTEXPR auto match_some(SomeFn &&some_fn) && -> unit_t;
 
     /**
      * Attempts to invoke function if is_some().
@@ -267,7 +344,7 @@ public:
      * @see is_some
      */
     template <class SomeFn>
-    auto match_some(SomeFn &&some_fn) const & -> unit_t;
+    RUSTFP_CONSTEXPR auto match_some(SomeFn &&some_fn) const & -> unit_t;
 
     /**
      * Attempts to invoke function if is_none().
@@ -279,7 +356,7 @@ public:
      * @see is_none
      */
     template <class NoneFn>
-    auto match_none(NoneFn &&none_fn) && -> unit_t;
+    RUSTFP_CONSTEXPR auto match_none(NoneFn &&none_fn) && -> unit_t;
 
     /**
      * Attempts to invoke function if is_none().
@@ -291,7 +368,7 @@ public:
      * @see is_none
      */
     template <class NoneFn>
-    auto match_none(NoneFn &&none_fn) const & -> unit_t;
+    RUSTFP_CONSTEXPR auto match_none(NoneFn &&none_fn) const & -> unit_t;
 
     /**
      * fn is_some(&self) -> bool
@@ -327,7 +404,7 @@ public:
      * Returns the contained value or a default.
      */
     template <class Tx>
-    auto unwrap_or(Tx &&def) && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_or(Tx &&def) && -> T;
 
     /**
      * fn unwrap_or_else<F>(self, f: F) -> T
@@ -337,7 +414,8 @@ public:
      * Returns the contained value or computes it from a closure.
      */
     template <class F>
-    auto unwrap_or_else(F &&f) && -> special_decay_t<std::result_of_t<F()>>;
+    RUSTFP_CONSTEXPR auto
+    unwrap_or_else(F &&f) && -> special_decay_t<std::result_of_t<F()>>;
 
     /**
      * fn map<U, F>(self, f: F) -> Option<U>
@@ -348,7 +426,8 @@ public:
      * value.
      */
     template <class F>
-    auto map(F &&fn) && -> Option<special_decay_t<std::result_of_t<F(T &&)>>>;
+    RUSTFP_CONSTEXPR auto
+    map(F &&fn) && -> Option<special_decay_t<std::result_of_t<F(T &&)>>>;
 
     /**
      * fn map_or<U, F>(self, default: U, f: F) -> U
@@ -359,7 +438,7 @@ public:
      * (if not).
      */
     template <class U, class F>
-    auto map_or(U &&def, F &&f) -> U;
+    RUSTFP_CONSTEXPR auto map_or(U &&def, F &&f) -> U;
 
     /**
      * fn map_or_else<U, D, F>(self, default: D, f: F) -> U
@@ -371,7 +450,8 @@ public:
      * (if not).
      */
     template <class D, class F>
-    auto map_or_else(D &&def, F &&f) -> special_decay_t<std::result_of_t<D()>>;
+    RUSTFP_CONSTEXPR auto
+    map_or_else(D &&def, F &&f) -> special_decay_t<std::result_of_t<D()>>;
 
     /**
      * fn ok_or<E>(self, err: E) -> Result<T, E>
@@ -380,7 +460,7 @@ public:
      * and None to Err(err).
      */
     template <class E>
-    auto ok_or(E &&e) && -> Result<T, E>;
+    RUSTFP_CONSTEXPR auto ok_or(E &&e) && -> Result<T, E>;
 
     /**
      * fn ok_or_else<E, F>(self, err: F) -> Result<T, E>
@@ -391,7 +471,7 @@ public:
      * and None to Err(err()).
      */
     template <class F>
-    auto
+    RUSTFP_CONSTEXPR auto
     ok_or_else(F &&err) && -> Result<T, special_decay_t<std::result_of_t<F()>>>;
 
     /**
@@ -400,7 +480,7 @@ public:
      * Returns None if the option is None, otherwise returns optb.
      */
     template <class U>
-    auto and_(Option<U> &&optb) && -> Option<U>;
+    RUSTFP_CONSTEXPR auto and_(Option<U> &&optb) && -> Option<U>;
 
     /**
      * fn and_then<U, F>(self, f: F) -> Option<U>
@@ -411,7 +491,7 @@ public:
      * value and returns the result.
      */
     template <class F>
-    auto
+    RUSTFP_CONSTEXPR auto
     and_then(F &&f) && -> Option<typename std::result_of_t<F(T &&)>::some_t>;
 
     /**
@@ -419,7 +499,7 @@ public:
      *
      * Returns the option if it contains a value, otherwise returns optb.
      */
-    auto or_(Option<T> &&optb) && -> Option<T>;
+    RUSTFP_CONSTEXPR auto or_(Option<T> &&optb) && -> Option<T>;
 
     /**
      * fn or_else<F>(self, f: F) -> Option<T>
@@ -430,7 +510,7 @@ public:
      * the result.
      */
     template <class F>
-    auto or_else(F &&f) && -> Option<T>;
+    RUSTFP_CONSTEXPR auto or_else(F &&f) && -> Option<T>;
 
     /**
      * fn get_or_insert(&mut self, v: T) -> &mut T
@@ -439,7 +519,7 @@ public:
      * to the contained value.
      */
     template <class Tx>
-    auto get_or_insert(Tx &&v) -> T &;
+    RUSTFP_CONSTEXPR auto get_or_insert(Tx &&v) -> T &;
 
     /**
      * fn get_or_insert_with<F>(&mut self, f: F) -> &mut T
@@ -450,14 +530,23 @@ public:
      * returns a mutable reference to the contained value.
      */
     template <class F>
-    auto get_or_insert_with(F &&f) -> T &;
+    RUSTFP_CONSTEXPR auto get_or_insert_with(F &&f) -> T &;
+
+    /**
+     * Replaces the contained item, if any, with the item constructed in place
+     * from the given arguments, then returns a mutable reference to it.
+     * Unlike assigning Some, this works for items that cannot be moved.
+     */
+    template <class... Args>
+    RUSTFP_CONSTEXPR auto emplace(Args &&... args)
+        -> std::add_lvalue_reference_t<std::remove_reference_t<T>>;
 
     /**
      * fn take(&mut self) -> Option<T>
      *
      * Takes the value out of the option, leaving a None in its place.
      */
-    auto take() -> Option<T>;
+    RUSTFP_CONSTEXPR auto take() -> Option<T>;
 
     /**
      * impl<'a, T> Option<&'a T>
@@ -467,7 +556,8 @@ public:
      *
      * Maps an Option<&T> to an Option<T> by cloning the contents of the option.
      */
-    auto cloned() && -> Option<std::remove_const_t<std::remove_reference_t<T>>>;
+    RUSTFP_CONSTEXPR auto
+    cloned() && -> Option<std::remove_const_t<std::remove_reference_t<T>>>;
 
     /**
      * impl<T> Option<T>
@@ -480,7 +570,7 @@ public:
      * Consumes the self argument then, if Some, returns the contained value,
      * otherwise if None, returns the default value for that type.
      */
-    auto unwrap_or_default() && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_or_default() && -> T;
 
 private:
     optional_t opt;
@@ -501,6 +591,20 @@ RUSTFP_CONSTEXPR auto Some(T &&value) RUSTFP_NOEXCEPT_EXPR(
     std::is_nothrow_constructible<Option<special_decay_t<T>>>::value)
     -> Option<special_decay_t<T>>;
 
+/**
+ * Generates a new Option with the item constructed in place from the given
+ * arguments, unlike Some, which moves the given item through the intermediate
+ * SomeImpl wrapper.
+ *
+ * The item type T must be specified. Returning an Option of an item that
+ * cannot be moved requires C++17 guaranteed copy elision, otherwise use
+ * Option::emplace.
+ * @param args arguments to construct the item with
+ * @see Option::emplace
+ */
+template <class T, class... Args>
+RUSTFP_CONSTEXPR auto make_some(Args &&... args) -> Option<T>;
+
 /**
  * Convenient function to generate Option based on bool value.
  *
@@ -514,7 +618,7 @@ RUSTFP_CONSTEXPR auto Some(T &&value) RUSTFP_NOEXCEPT_EXPR(
  * @see Option::is_none
  */
 template <class SomeFn>
-auto opt_if(const bool cond, SomeFn &&some_fn)
+RUSTFP_CONSTEXPR auto opt_if(const bool cond, SomeFn &&some_fn)
     -> Option<std::result_of_t<SomeFn()>>;
 
 // implementation section
@@ -538,6 +642,309 @@ public:
 private:
     reverse_decay_t<T> value;
 };
+
+// Storage whose moved-from value is reset to None
+template <class Storage>
+class OptionResetOnMove : public Storage {
+public:
+    using Storage::Storage;
+
+    OptionResetOnMove() = default;
+
+    // nonstd::optional has no portable in place constructor across its
+    // versions, so the item is emplaced into the empty storage instead
+    template <class... Args>
+    explicit OptionResetOnMove(some_tag_t, Args &&... args) : Storage() {
+        this->emplace(std::forward<Args>(args)...);
+    }
+
+    template <class F, class... Args>
+    OptionResetOnMove(invoke_tag_t, F &&f, Args &&... args) : Storage() {
+        this->emplace(std::forward<F>(f)(std::forward<Args>(args)...));
+    }
+
+    OptionResetOnMove(const OptionResetOnMove &rhs) = default;
+
+    OptionResetOnMove(OptionResetOnMove &&rhs) RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<Storage>::value)
+        : Storage(std::move(rhs)) {
+
+        rhs.reset();
+    }
+
+    auto operator=(const OptionResetOnMove &rhs)
+        -> OptionResetOnMove & = default;
+
+    auto operator=(OptionResetOnMove &&rhs) -> OptionResetOnMove & {
+        Storage::operator=(std::move(rhs));
+        rhs.reset();
+        return *this;
+    }
+
+    template <
+        class Tx,
+        class = std::enable_if_t<!std::is_same<
+            OptionResetOnMove,
+            std::remove_const_t<std::remove_reference_t<Tx>>>::value>>
+    auto operator=(Tx &&value) -> OptionResetOnMove & {
+        Storage::operator=(std::forward<Tx>(value));
+        return *this;
+    }
+};
+
+// trivially copyable T with an engaged flag and the same interface as
+// nonstd::optional<T>
+template <class T>
+class OptionTrivialStorage {
+public:
+    RUSTFP_CONSTEXPR OptionTrivialStorage() RUSTFP_NOEXCEPT
+        : storage(),
+          engaged(false) {
+    }
+
+    RUSTFP_CONSTEXPR OptionTrivialStorage(const nonstd::nullopt_t &)
+        RUSTFP_NOEXCEPT : storage(),
+                          engaged(false) {
+    }
+
+    template <
+        class Tx,
+        class = std::enable_if_t<
+            !std::is_same<OptionTrivialStorage, std::decay_t<Tx>>::value
+            && !std::is_same<nonstd::nullopt_t, std::decay_t<Tx>>::value
+            && !std::is_same<some_tag_t, std::decay_t<Tx>>::value>>
+    RUSTFP_CONSTEXPR OptionTrivialStorage(Tx &&value)
+        : storage(some_tag_t{}, std::forward<Tx>(value)), engaged(true) {
+    }
+
+    template <class... Args>
+    RUSTFP_CONSTEXPR explicit OptionTrivialStorage(some_tag_t, Args &&... args)
+        : storage(some_tag_t{}, std::forward<Args>(args)...), engaged(true) {
+    }
+
+    template <class F, class... Args>
+    RUSTFP_CONSTEXPR OptionTrivialStorage(
+        invoke_tag_t, F &&f, Args &&... args)
+        : storage(
+              invoke_tag_t{},
+              std::forward<F>(f),
+              std::forward<Args>(args)...),
+          engaged(true) {
+    }
+
+    template <
+        class Tx,
+        class = std::enable_if_t<
+            !std::is_same<OptionTrivialStorage, std::decay_t<Tx>>::value>>
+    RUSTFP_CONSTEXPR auto operator=(Tx &&value) -> OptionTrivialStorage & {
+        *this = OptionTrivialStorage(std::forward<Tx>(value));
+        return *this;
+    }
+
+    template <class... Args>
+    RUSTFP_CONSTEXPR void emplace(Args &&... args) {
+        emplace_impl(std::is_copy_assignable<T>(), std::forward<Args>(args)...);
+    }
+
+    RUSTFP_CONSTEXPR auto has_value() const RUSTFP_NOEXCEPT -> bool {
+        return engaged;
+    }
+
+    RUSTFP_CONSTEXPR explicit operator bool() const RUSTFP_NOEXCEPT {
+        return engaged;
+    }
+
+    RUSTFP_CONSTEXPR auto operator*() const RUSTFP_NOEXCEPT -> const T & {
+        return storage.value;
+    }
+
+    RUSTFP_CONSTEXPR auto operator*() RUSTFP_NOEXCEPT -> T & {
+        return storage.value;
+    }
+
+    RUSTFP_CONSTEXPR void reset() RUSTFP_NOEXCEPT {
+        engaged = false;
+    }
+
+private:
+    template <class... Args>
+    RUSTFP_CONSTEXPR void emplace_impl(std::true_type, Args &&... args) {
+        *this = OptionTrivialStorage(some_tag_t{}, std::forward<Args>(args)...);
+    }
+
+    // T such as a closure cannot be assigned, but is trivially destructible,
+    // so the whole union is rebuilt over the old one. Unlike T, the union has
+    // no const or reference members, so storage can still be used to refer
+    // to the new union without std::launder before C++20
+    template <class... Args>
+    void emplace_impl(std::false_type, Args &&... args) {
+        storage.~Storage();
+
+        ::new (static_cast<void *>(&storage))
+            Storage(some_tag_t{}, std::forward<Args>(args)...);
+
+        engaged = true;
+    }
+
+    // union members are trivially copyable as long as T is
+    union Storage {
+        RUSTFP_CONSTEXPR Storage() RUSTFP_NOEXCEPT : none() {
+        }
+
+        template <class... Args>
+        RUSTFP_CONSTEXPR explicit Storage(some_tag_t, Args &&... args)
+            : value(std::forward<Args>(args)...) {
+        }
+
+        template <class F, class... Args>
+        RUSTFP_CONSTEXPR Storage(invoke_tag_t, F &&f, Args &&... args)
+            : value(std::forward<F>(f)(std::forward<Args>(args)...)) {
+        }
+
+        unit_t none;
+        T value;
+    };
+
+    Storage storage;
+    bool engaged;
+};
+
+// trivially copyable pointer with the same interface as
+// nonstd::optional<std::reference_wrapper<T>>, where nullptr represents None
+template <class T>
+class OptionRefStorage {
+public:
+    RUSTFP_CONSTEXPR OptionRefStorage() RUSTFP_NOEXCEPT : ptr(nullptr) {
+    }
+
+    RUSTFP_CONSTEXPR OptionRefStorage(const nonstd::nullopt_t &)
+        RUSTFP_NOEXCEPT : ptr(nullptr) {
+    }
+
+    RUSTFP_CONSTEXPR OptionRefStorage(T &value) RUSTFP_NOEXCEPT
+        : ptr(&value) {
+    }
+
+    OptionRefStorage(const std::reference_wrapper<T> value) RUSTFP_NOEXCEPT
+        : ptr(&value.get()) {
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR OptionRefStorage(some_tag_t, Tx &&value) RUSTFP_NOEXCEPT
+        : OptionRefStorage(std::forward<Tx>(value)) {
+    }
+
+    template <class F, class... Args>
+    RUSTFP_CONSTEXPR OptionRefStorage(invoke_tag_t, F &&f, Args &&... args)
+        : OptionRefStorage(std::forward<F>(f)(std::forward<Args>(args)...)) {
+    }
+
+    RUSTFP_CONSTEXPR auto has_value() const RUSTFP_NOEXCEPT -> bool {
+        return ptr != nullptr;
+    }
+
+    RUSTFP_CONSTEXPR explicit operator bool() const RUSTFP_NOEXCEPT {
+        return ptr != nullptr;
+    }
+
+    auto operator*() const RUSTFP_NOEXCEPT -> std::reference_wrapper<T> {
+        return std::reference_wrapper<T>(*ptr);
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR void emplace(Tx &&value) RUSTFP_NOEXCEPT {
+        *this = OptionRefStorage(std::forward<Tx>(value));
+    }
+
+    RUSTFP_CONSTEXPR void reset() RUSTFP_NOEXCEPT {
+        ptr = nullptr;
+    }
+
+private:
+    T *ptr;
+};
+
+// T with the same interface as nonstd::optional<T>, where the sentinel value
+// declared via option_niche<T> represents None. Storing the sentinel as Some
+// would silently turn into None, so every path that stores a value asserts
+// against it
+template <class T>
+class OptionNicheStorage {
+    using niche_t = option_niche<T>;
+
+public:
+    RUSTFP_CONSTEXPR OptionNicheStorage() : value(niche_t::none_value()) {
+    }
+
+    RUSTFP_CONSTEXPR OptionNicheStorage(const nonstd::nullopt_t &)
+        : value(niche_t::none_value()) {
+    }
+
+    template <
+        class Tx,
+        class = std::enable_if_t<
+            !std::is_same<OptionNicheStorage, std::decay_t<Tx>>::value
+            && !std::is_same<nonstd::nullopt_t, std::decay_t<Tx>>::value
+            && !std::is_same<some_tag_t, std::decay_t<Tx>>::value>>
+    RUSTFP_CONSTEXPR OptionNicheStorage(Tx &&value)
+        : value(std::forward<Tx>(value)) {
+
+        assert(has_value());
+    }
+
+    template <class... Args>
+    RUSTFP_CONSTEXPR explicit OptionNicheStorage(some_tag_t, Args &&... args)
+        : value(std::forward<Args>(args)...) {
+
+        assert(has_value());
+    }
+
+    template <class F, class... Args>
+    RUSTFP_CONSTEXPR OptionNicheStorage(invoke_tag_t, F &&f, Args &&... args)
+        : value(std::forward<F>(f)(std::forward<Args>(args)...)) {
+
+        assert(has_value());
+    }
+
+    template <
+        class Tx,
+        class = std::enable_if_t<
+            !std::is_same<OptionNicheStorage, std::decay_t<Tx>>::value>>
+    RUSTFP_CONSTEXPR auto operator=(Tx &&value) -> OptionNicheStorage & {
+        this->value = std::forward<Tx>(value);
+        assert(has_value());
+        return *this;
+    }
+
+    template <class... Args>
+    RUSTFP_CONSTEXPR void emplace(Args &&... args) {
+        value = T(std::forward<Args>(args)...);
+        assert(has_value());
+    }
+
+    RUSTFP_CONSTEXPR auto has_value() const -> bool {
+        return !niche_t::is_none(value);
+    }
+
+    RUSTFP_CONSTEXPR explicit operator bool() const {
+        return !niche_t::is_none(value);
+    }
+
+    RUSTFP_CONSTEXPR auto operator*() const -> const T & {
+        return value;
+    }
+
+    RUSTFP_CONSTEXPR auto operator*() -> T & {
+        return value;
+    }
+
+    RUSTFP_CONSTEXPR void reset() {
+        value = niche_t::none_value();
+    }
+
+private:
+    T value;
+};
 } // namespace details
 
 template <class T>
@@ -551,15 +958,6 @@ RUSTFP_CONSTEXPR Option<T>::Option(details::SomeImpl<Tx> &&value)
         "T cannot be constructed from Tx");
 }
 
-template <class T>
-RUSTFP_CONSTEXPR Option<T>::Option(const Option<T> &rhs)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_copy_constructible<optional_t>::value)
-    : opt(rhs.opt) {
-
-    static_assert(
-        std::is_copy_constructible<T>::value, "T is not copy constructible");
-}
-
 template <class T>
 template <class Tx>
 RUSTFP_CONSTEXPR Option<T>::Option(const Option<Tx> &rhs)
@@ -571,17 +969,6 @@ RUSTFP_CONSTEXPR Option<T>::Option(const Option<Tx> &rhs)
         "T cannot be constructed from Tx");
 }
 
-template <class T>
-RUSTFP_CONSTEXPR Option<T>::Option(Option<T> &&rhs)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_constructible<optional_t>::value)
-    : opt(std::move(rhs.opt)) {
-
-    static_assert(
-        std::is_move_constructible<T>::value, "T is not move constructible");
-
-    rhs.opt.reset();
-}
-
 template <class T>
 template <class Tx>
 RUSTFP_CONSTEXPR Option<T>::Option(Option<Tx> &&rhs)
@@ -602,51 +989,50 @@ RUSTFP_CONSTEXPR Option<T>::Option(const none_t &) RUSTFP_NOEXCEPT_EXPR(
 }
 
 template <class T>
-template <class Tx>
-auto Option<T>::operator=(details::SomeImpl<Tx> &&value) -> Option<T> & {
-    static_assert(
-        std::is_assignable<reverse_decay_t<T>, reverse_decay_t<Tx>>::value,
-        "T is not assignable from Tx");
-
-    opt = std::move(value).move();
-    return *this;
+template <class... Args>
+RUSTFP_CONSTEXPR Option<T>::Option(details::some_tag_t, Args &&... args)
+    : opt(details::some_tag_t{}, std::forward<Args>(args)...) {
 }
 
 template <class T>
-auto Option<T>::operator=(const Option<T> &rhs) -> Option<T> & {
-    static_assert(
-        std::is_copy_assignable<T>::value, "T is not copy assignable");
-
-    opt = rhs.opt;
-    return *this;
+template <class F, class... Args>
+RUSTFP_CONSTEXPR Option<T>::Option(
+    details::invoke_tag_t, F &&f, Args &&... args)
+    : opt(
+          details::invoke_tag_t{},
+          std::forward<F>(f),
+          std::forward<Args>(args)...) {
 }
 
 template <class T>
 template <class Tx>
-auto Option<T>::operator=(const Option<Tx> &rhs) -> Option<T> & {
+RUSTFP_CONSTEXPR auto Option<T>::operator=(details::SomeImpl<Tx> &&value)
+    -> Option<T> & {
+
     static_assert(
         std::is_assignable<reverse_decay_t<T>, reverse_decay_t<Tx>>::value,
         "T is not assignable from Tx");
 
-    opt = rhs.opt ? optional_t(*rhs.opt) : nonstd::nullopt;
+    opt = std::move(value).move();
     return *this;
 }
 
 template <class T>
-auto Option<T>::operator=(Option<T> &&rhs) -> Option<T> & {
-    static_assert(
-        std::is_move_assignable<reverse_decay_t<T>>::value,
-        "T is not move assignable");
+template <class Tx>
+RUSTFP_CONSTEXPR auto Option<T>::operator=(const Option<Tx> &rhs)
+    -> Option<T> & {
 
-    opt = std::move(rhs.opt);
-    rhs.opt.reset();
+    static_assert(
+        std::is_assignable<reverse_decay_t<T>, reverse_decay_t<Tx>>::value,
+        "T is not assignable from Tx");
 
+    opt = rhs.opt ? optional_t(*rhs.opt) : nonstd::nullopt;
     return *this;
 }
 
 template <class T>
 template <class Tx>
-auto Option<T>::operator=(Option<Tx> &&rhs) -> Option<T> & {
+RUSTFP_CONSTEXPR auto Option<T>::operator=(Option<Tx> &&rhs) -> Option<T> & {
     static_assert(
         std::is_assignable<reverse_decay_t<T>, reverse_decay_t<Tx>>::value,
         "T is not assignable from Tx");
@@ -658,7 +1044,7 @@ auto Option<T>::operator=(Option<Tx> &&rhs) -> Option<T> & {
 }
 
 template <class T>
-auto Option<T>::operator=(const none_t &) -> Option<T> & {
+RUSTFP_CONSTEXPR auto Option<T>::operator=(const none_t &) -> Option<T> & {
     opt.reset();
     return *this;
 }
@@ -681,7 +1067,7 @@ RUSTFP_CONSTEXPR auto Option<T>::get_mut_unchecked() RUSTFP_NOEXCEPT
 }
 
 template <class T>
-auto Option<T>::unwrap_unchecked() && -> T {
+RUSTFP_CONSTEXPR auto Option<T>::unwrap_unchecked() && -> T {
     // forward moves rref value only, lref remains as lref
     reverse_decay_t<T> value = std::forward<T>(*opt);
     opt.reset();
@@ -692,7 +1078,7 @@ auto Option<T>::unwrap_unchecked() && -> T {
 
 template <class T>
 template <class SomeFn, class NoneFn>
-auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
+RUSTFP_CONSTEXPR auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
     && -> std::common_type_t<
         std::result_of_t<SomeFn(some_t)>,
         std::result_of_t<NoneFn()>> {
@@ -702,7 +1088,7 @@ auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
 
 template <class T>
 template <class SomeFn, class NoneFn>
-auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
+RUSTFP_CONSTEXPR auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
     const & -> std::common_type_t<
         std::result_of_t<SomeFn(const some_t &)>,
         std::result_of_t<NoneFn()>> {
@@ -712,7 +1098,7 @@ auto Option<T>::match(SomeFn &&some_fn, NoneFn &&none_fn)
 
 template <class T>
 template <class SomeFn>
-auto Option<T>::match_some(SomeFn &&some_fn) && -> unit_t {
+RUSTFP_CONSTEXPR auto Option<T>::match_some(SomeFn &&some_fn) && -> unit_t {
     if (is_some()) {
         some_fn(std::move(*this).unwrap_unchecked());
     }
@@ -722,7 +1108,9 @@ auto Option<T>::match_some(SomeFn &&some_fn) && -> unit_t {
 
 template <class T>
 template <class SomeFn>
-auto Option<T>::match_some(SomeFn &&some_fn) const & -> unit_t {
+RUSTFP_CONSTEXPR auto Option<T>::match_some(SomeFn &&some_fn)
+    const & -> unit_t {
+
     if (is_some()) {
         some_fn(get_unchecked());
     }
@@ -732,7 +1120,7 @@ auto Option<T>::match_some(SomeFn &&some_fn) const & -> unit_t {
 
 template <class T>
 template <class NoneFn>
-auto Option<T>::match_none(NoneFn &&none_fn) && -> unit_t {
+RUSTFP_CONSTEXPR auto Option<T>::match_none(NoneFn &&none_fn) && -> unit_t {
     if (is_none()) {
         none_fn();
     }
@@ -742,7 +1130,9 @@ auto Option<T>::match_none(NoneFn &&none_fn) && -> unit_t {
 
 template <class T>
 template <class NoneFn>
-auto Option<T>::match_none(NoneFn &&none_fn) const & -> unit_t {
+RUSTFP_CONSTEXPR auto Option<T>::match_none(NoneFn &&none_fn)
+    const & -> unit_t {
+
     if (is_none()) {
         none_fn();
     }
@@ -776,7 +1166,7 @@ auto Option<T>::as_mut() -> Option<T &> {
 
 template <class T>
 template <class Tx>
-auto Option<T>::unwrap_or(Tx &&def) && -> T {
+RUSTFP_CONSTEXPR auto Option<T>::unwrap_or(Tx &&def) && -> T {
     if (is_some()) {
         return std::move(*this).unwrap_unchecked();
     } else {
@@ -786,7 +1176,7 @@ auto Option<T>::unwrap_or(Tx &&def) && -> T {
 
 template <class T>
 template <class F>
-auto Option<T>::unwrap_or_else(
+RUSTFP_CONSTEXPR auto Option<T>::unwrap_or_else(
     F &&f) && -> special_decay_t<std::result_of_t<F()>> {
 
     if (is_some()) {
@@ -798,11 +1188,14 @@ auto Option<T>::unwrap_or_else(
 
 template <class T>
 template <class F>
-auto Option<T>::map(
+RUSTFP_CONSTEXPR auto Option<T>::map(
     F &&f) && -> Option<special_decay_t<std::result_of_t<F(T &&)>>> {
 
+    using result_t = Option<special_decay_t<std::result_of_t<F(T &&)>>>;
+
     if (is_some()) {
-        return Some(f(std::move(*this).unwrap_unchecked()));
+        return result_t(
+            details::invoke_tag_t{}, f, std::move(*this).unwrap_unchecked());
     } else {
         return None;
     }
@@ -810,7 +1203,7 @@ auto Option<T>::map(
 
 template <class T>
 template <class U, class F>
-auto Option<T>::map_or(U &&def, F &&f) -> U {
+RUSTFP_CONSTEXPR auto Option<T>::map_or(U &&def, F &&f) -> U {
     if (is_some()) {
         return special_decay(f(std::move(*this).unwrap_unchecked()));
     } else {
@@ -820,7 +1213,7 @@ auto Option<T>::map_or(U &&def, F &&f) -> U {
 
 template <class T>
 template <class D, class F>
-auto Option<T>::map_or_else(D &&def, F &&f)
+RUSTFP_CONSTEXPR auto Option<T>::map_or_else(D &&def, F &&f)
     -> special_decay_t<std::result_of_t<D()>> {
 
     if (is_some()) {
@@ -832,7 +1225,7 @@ auto Option<T>::map_or_else(D &&def, F &&f)
 
 template <class T>
 template <class E>
-auto Option<T>::ok_or(E &&e) && -> Result<T, E> {
+RUSTFP_CONSTEXPR auto Option<T>::ok_or(E &&e) && -> Result<T, E> {
     if (is_some()) {
         return Ok(reverse_decay(std::move(*this).unwrap_unchecked()));
     } else {
@@ -842,7 +1235,7 @@ auto Option<T>::ok_or(E &&e) && -> Result<T, E> {
 
 template <class T>
 template <class F>
-auto Option<T>::ok_or_else(
+RUSTFP_CONSTEXPR auto Option<T>::ok_or_else(
     F &&err) && -> Result<T, special_decay_t<std::result_of_t<F()>>> {
 
     if (is_some()) {
@@ -854,10 +1247,10 @@ auto Option<T>::ok_or_else(
 
 template <class T>
 template <class U>
-auto Option<T>::and_(Option<U> &&optb) && -> Option<U> {
+RUSTFP_CONSTEXPR auto Option<T>::and_(Option<U> &&optb) && -> Option<U> {
     if (is_some()) {
         opt.reset();
-        return std::move(optb);
+        return optb.take();
     } else {
         optb.opt.reset();
         return None;
@@ -866,7 +1259,7 @@ auto Option<T>::and_(Option<U> &&optb) && -> Option<U> {
 
 template <class T>
 template <class F>
-auto Option<T>::and_then(
+RUSTFP_CONSTEXPR auto Option<T>::and_then(
     F &&f) && -> Option<typename std::result_of_t<F(T &&)>::some_t> {
 
     if (is_some()) {
@@ -877,24 +1270,24 @@ auto Option<T>::and_then(
 }
 
 template <class T>
-auto Option<T>::or_(Option<T> &&optb) && -> Option<T> {
+RUSTFP_CONSTEXPR auto Option<T>::or_(Option<T> &&optb) && -> Option<T> {
     if (is_some()) {
         optb.opt.reset();
-        return std::move(*this);
+        return take();
     } else {
-        return std::move(optb);
+        return optb.take();
     }
 }
 
 template <class T>
 template <class F>
-auto Option<T>::or_else(F &&f) && -> Option<T> {
-    return is_some() ? std::move(*this) : f();
+RUSTFP_CONSTEXPR auto Option<T>::or_else(F &&f) && -> Option<T> {
+    return is_some() ? take() : f();
 }
 
 template <class T>
 template <class Tx>
-auto Option<T>::get_or_insert(Tx &&v) -> T & {
+RUSTFP_CONSTEXPR auto Option<T>::get_or_insert(Tx &&v) -> T & {
     if (is_none()) {
         opt = std::forward<Tx>(v);
     }
@@ -904,7 +1297,7 @@ auto Option<T>::get_or_insert(Tx &&v) -> T & {
 
 template <class T>
 template <class F>
-auto Option<T>::get_or_insert_with(F &&f) -> T & {
+RUSTFP_CONSTEXPR auto Option<T>::get_or_insert_with(F &&f) -> T & {
     if (is_none()) {
         opt = f();
     }
@@ -913,7 +1306,16 @@ auto Option<T>::get_or_insert_with(F &&f) -> T & {
 }
 
 template <class T>
-auto Option<T>::take() -> Option<T> {
+template <class... Args>
+RUSTFP_CONSTEXPR auto Option<T>::emplace(Args &&... args)
+    -> std::add_lvalue_reference_t<std::remove_reference_t<T>> {
+
+    opt.emplace(std::forward<Args>(args)...);
+    return get_mut_unchecked();
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Option<T>::take() -> Option<T> {
     if (is_some()) {
         return Some(reverse_decay(std::move(*this).unwrap_unchecked()));
     } else {
@@ -922,7 +1324,7 @@ auto Option<T>::take() -> Option<T> {
 }
 
 template <class T>
-auto Option<T>::cloned()
+RUSTFP_CONSTEXPR auto Option<T>::cloned()
     && -> Option<std::remove_const_t<std::remove_reference_t<T>>> {
 
     if (is_some()) {
@@ -934,7 +1336,7 @@ auto Option<T>::cloned()
 }
 
 template <class T>
-auto Option<T>::unwrap_or_default() && -> T {
+RUSTFP_CONSTEXPR auto Option<T>::unwrap_or_default() && -> T {
     if (is_some()) {
         // no need to convert & to reference_wrapper
         return std::move(*this).unwrap_unchecked();
@@ -952,8 +1354,13 @@ RUSTFP_CONSTEXPR auto Some(T &&value) RUSTFP_NOEXCEPT_EXPR(
         details::SomeImpl<special_decay_t<T>>(std::forward<T>(value)));
 }
 
+template <class T, class... Args>
+RUSTFP_CONSTEXPR auto make_some(Args &&... args) -> Option<T> {
+    return Option<T>(details::some_tag_t{}, std::forward<Args>(args)...);
+}
+
 template <class SomeFn>
-auto opt_if(const bool cond, SomeFn &&some_fn)
+RUSTFP_CONSTEXPR auto opt_if(const bool cond, SomeFn &&some_fn)
     -> Option<std::result_of_t<SomeFn()>> {
 
     if (cond) {
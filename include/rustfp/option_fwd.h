@@ -19,8 +19,19 @@ namespace rustfp {
 template <class T>
 class Option;
 
+namespace details {
+template <class T>
+struct option_storage_impl;
+
+// constructs the item in place from the given arguments
+struct some_tag_t {};
+
+// constructs the item in place from the result of invoking the given function
+struct invoke_tag_t {};
+} // namespace details
+
 struct none_t {};
-const none_t None{};
+constexpr none_t None{};
 
 template <class T>
 RUSTFP_CONSTEXPR auto Some(T &&value) RUSTFP_NOEXCEPT_EXPR(
@@ -0,0 +1,56 @@
+/**
+ * Contains the customization trait for types to declare a sentinel value that
+ * Option can use to represent None, so that sizeof(Option<T>) == sizeof(T).
+ *
+ * Rust Option representation:
+ * https://doc.rust-lang.org/std/option/index.html#representation
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "specs.h"
+
+#include <type_traits>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * Customization trait for Option<T> to store None as a sentinel value of T
+ * instead of a separate engaged flag. Disabled by default.
+ *
+ * To enable it, specialize the trait for T, deriving from std::true_type, and
+ * provide:
+ * - static T none_value(), which returns the sentinel value.
+ * - static bool is_none(const T &value), which checks for the sentinel value.
+ *
+ * Some must never be given the sentinel value, otherwise it is observed as
+ * None, which is checked by assert in debug builds.
+ * @tparam T Item type of Option
+ */
+template <class T>
+struct option_niche : std::false_type {};
+
+/**
+ * Convenient base of option_niche specialization for integral and enum types,
+ * which uses the given constant as the sentinel value.
+ * @tparam T Integral or enum item type of Option
+ * @tparam Sentinel Value of T to represent None
+ */
+template <class T, T Sentinel>
+struct option_niche_sentinel : std::true_type {
+    static RUSTFP_CONSTEXPR auto none_value() RUSTFP_NOEXCEPT -> T {
+        return Sentinel;
+    }
+
+    static RUSTFP_CONSTEXPR auto is_none(const T &value) RUSTFP_NOEXCEPT
+        -> bool {
+
+        return value == Sentinel;
+    }
+};
+} // namespace rustfp
@@ -0,0 +1,250 @@
+/**
+ * Contains Rust Iterator peekable equivalent implementation.
+ *
+ * peekable function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.peekable
+ *
+ * Peekable struct: https://doc.rust-lang.org/std/iter/struct.Peekable.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "util.h"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<I: Iterator> Iterator for Peekable<I>
+ * type Item = <I as Iterator>::Item
+ *
+ * Caches at most one item, which is the item itself if Item is a value type,
+ * or only the reference if Item is a reference type, so peeking never copies
+ * the referred values.
+ */
+template <class Self>
+class Peekable {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = typename Self::Item;
+
+    /**
+     * Type of the immutable reference to the peeked item.
+     */
+    using PeekItem = std::add_lvalue_reference_t<
+        std::add_const_t<std::remove_reference_t<Item>>>;
+
+    /**
+     * Takes in the moved rustfp Iter instance.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     */
+    template <class Selfx>
+    explicit Peekable(Selfx &&self);
+
+    /**
+     * Generates the peeked item if there is one, otherwise the next item of
+     * the underlying iterator.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * fn peek(&mut self) -> Option<&Self::Item>
+     *
+     * Returns the reference to the next item without advancing the iterator.
+     * The reference is valid until the next call to any other method.
+     * @return Some(PeekItem) if there is a next value to generate,
+     * otherwise None.
+     */
+    auto peek() -> Option<PeekItem>;
+
+    /**
+     * fn next_if(&mut self, func: impl FnOnce(&Self::Item) -> bool)
+     *     -> Option<Self::Item>
+     *
+     * Generates the next item only if the predicate returns true for it,
+     * otherwise keeps the item to be generated later.
+     * @tparam P Predicate type, where P: (PeekItem) -> bool
+     * @param pred Predicate to test the next item with
+     * @return Some(Item) if there is a next value that satisfies the
+     * predicate, otherwise None.
+     */
+    template <class P>
+    auto next_if(P &&pred) -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, including the peeked
+     * item.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, including the peeked item.
+     * Only available if the underlying iterator is exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Folds the peeked item first, then forwards to the fold of the
+     * underlying iterator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+private:
+    auto peeked_len() const -> size_t;
+
+    Self self;
+    Option<Item> peeked;
+    bool has_peeked;
+};
+
+class PeekableOp {
+public:
+    template <class Self>
+    auto operator()(Self &&self) && -> Peekable<Self>;
+};
+
+/**
+ * fn peekable(self) -> Peekable<Self>
+ */
+auto peekable() -> PeekableOp;
+
+// implementation section
+
+template <class Self>
+template <class Selfx>
+Peekable<Self>::Peekable(Selfx &&self)
+    : self(std::forward<Selfx>(self)), peeked(None), has_peeked(false) {
+}
+
+template <class Self>
+auto Peekable<Self>::next() -> Option<Item> {
+    if (has_peeked) {
+        has_peeked = false;
+        return peeked.take();
+    }
+
+    return self.next();
+}
+
+template <class Self>
+auto Peekable<Self>::peek() -> Option<PeekItem> {
+    if (!has_peeked) {
+        peeked = self.next();
+        has_peeked = true;
+    }
+
+    if (peeked.is_none()) {
+        return None;
+    }
+
+    return Some(std::cref(peeked.get_unchecked()));
+}
+
+template <class Self>
+template <class P>
+auto Peekable<Self>::next_if(P &&pred) -> Option<Item> {
+    auto item_opt = next();
+
+    if (item_opt.is_some() && pred(item_opt.get_unchecked())) {
+        return item_opt;
+    }
+
+    // keeps the item, or the end of iteration, for the subsequent calls
+    peeked = std::move(item_opt);
+    has_peeked = true;
+    return None;
+}
+
+template <class Self>
+auto Peekable<Self>::size_hint() const -> size_hint_t {
+    if (has_peeked && peeked.is_none()) {
+        return details::exact_size_hint(0);
+    }
+
+    const auto hint = details::size_hint(self);
+    const auto len = peeked_len();
+
+    return size_hint_t(
+        hint.first + len,
+        hint.second.is_some() ? Some(hint.second.get_unchecked() + len)
+                              : None);
+}
+
+template <class Self>
+template <class S, class>
+auto Peekable<Self>::len() const -> size_t {
+    if (has_peeked && peeked.is_none()) {
+        return 0;
+    }
+
+    return self.len() + peeked_len();
+}
+
+template <class Self>
+template <class Acc, class G>
+auto Peekable<Self>::fold(Acc init, G &&g) -> Acc {
+    if (has_peeked) {
+        has_peeked = false;
+
+        if (peeked.is_none()) {
+            return init;
+        }
+
+        init = g(std::move(init), std::move(peeked).unwrap_unchecked());
+    }
+
+    return details::fold(self, std::move(init), g);
+}
+
+template <class Self>
+auto Peekable<Self>::peeked_len() const -> size_t {
+    return has_peeked && peeked.is_some() ? 1 : 0;
+}
+
+template <class Self>
+auto PeekableOp::operator()(Self &&self) && -> Peekable<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "peekable can only take rvalue ref object with Iterator traits");
+
+    return Peekable<Self>(std::move(self));
+}
+
+inline auto peekable() -> PeekableOp {
+    return PeekableOp();
+}
+} // namespace rustfp
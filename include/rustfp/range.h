@@ -7,9 +7,14 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -34,18 +39,183 @@ public:
      * @param start_index Index value to start from.
      * @param count Number of indices to generate from the start index.
      */
-    Range(const Index current_index, const size_t count_left);
+    RUSTFP_CONSTEXPR Range(const Index current_index, const size_t count_left);
 
     /**
      * Generates the next value of range operation.
      * @return Some(Item) if there is a next value to generate,
      * otherwise None.
      */
-    auto next() -> Option<Item>;
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, which is always exact.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left.
+     * @return Number of items left.
+     */
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Returns the index at offset i from the front without advancing the
+     * iterator or checking the bounds.
+     * @param i Offset of the index, which must be less than len()
+     * @return Index at the offset.
+     */
+    RUSTFP_CONSTEXPR auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the range by n indices in O(1) without generating them.
+     * @param n Number of indices to advance by
+     * @return Ok(Unit) if n indices are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value from the back of the range.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the range from the back by n indices in O(1) without
+     * generating them.
+     * @param n Number of indices to advance by
+     * @return Ok(Unit) if n indices are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_back_by(const size_t n)
+        -> Result<unit_t, size_t>;
+
+private:
+    Index current_index;
+    size_t count_left;
+};
+
+/**
+ * Iterator structure to hold the indices to be generated, which are step
+ * apart from each other. Similar to StepBy<Range<Index>> in Rust, except that
+ * the step can be negative to generate the indices in descending order.
+ * @tparam Index Index type to be used.
+ */
+template <class Index>
+class StepRange {
+public:
+    /**
+     * Item type to generate.
+     */
+    using Item = Index;
+
+    /**
+     * Initialize the StepRange Iterator with the start index, count and step.
+     * @param current_index Index value to start from.
+     * @param count_left Number of indices to generate from the start index.
+     * @param step Difference between consecutive indices.
+     */
+    RUSTFP_CONSTEXPR StepRange(
+        const Index current_index,
+        const size_t count_left,
+        const std::ptrdiff_t step);
+
+    /**
+     * Generates the next value of range operation.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, which is always exact.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left.
+     * @return Number of items left.
+     */
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Returns the index at offset i from the front without advancing the
+     * iterator or checking the bounds.
+     * @param i Offset of the index, which must be less than len()
+     * @return Index at the offset.
+     */
+    RUSTFP_CONSTEXPR auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Advances the range by n indices in O(1) without generating them.
+     * @param n Number of indices to advance by
+     * @return Ok(Unit) if n indices are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value from the back of the range.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
+
+    /**
+     * Advances the range from the back by n indices in O(1) without
+     * generating them.
+     * @param n Number of indices to advance by
+     * @return Ok(Unit) if n indices are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_back_by(const size_t n)
+        -> Result<unit_t, size_t>;
 
 private:
     Index current_index;
     size_t count_left;
+    std::ptrdiff_t step;
 };
 
 /**
@@ -56,17 +226,33 @@ private:
  * @return Iterator to generate the indices.
  */
 template <class Index>
-auto range(const Index start_index, const size_t count) -> Range<Index>;
+RUSTFP_CONSTEXPR auto range(const Index start_index, const size_t count)
+    -> Range<Index>;
+
+/**
+ * Creates an Iterator to generate a range of indices that are step apart.
+ * @tparam Index Index type to be used.
+ * @param start_index Index value to start from.
+ * @param count Number of indices to generate from the start index.
+ * @param step Difference between consecutive indices, which generates the
+ * indices in descending order if negative.
+ * @return Iterator to generate the indices.
+ */
+template <class Index>
+RUSTFP_CONSTEXPR auto range(
+    const Index start_index, const size_t count, const std::ptrdiff_t step)
+    -> StepRange<Index>;
 
 // implementation section
 
 template <class Index>
-Range<Index>::Range(const Index current_index, const size_t count_left)
+RUSTFP_CONSTEXPR Range<Index>::Range(
+    const Index current_index, const size_t count_left)
     : current_index(current_index), count_left(count_left) {
 }
 
 template <class Index>
-auto Range<Index>::next() -> Option<Item> {
+RUSTFP_CONSTEXPR auto Range<Index>::next() -> Option<Item> {
     if (count_left > 0) {
         --count_left;
         return Some(current_index++);
@@ -76,7 +262,208 @@ auto Range<Index>::next() -> Option<Item> {
 }
 
 template <class Index>
-auto range(const Index start_index, const size_t count) -> Range<Index> {
+RUSTFP_CONSTEXPR auto Range<Index>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(count_left);
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto Range<Index>::len() const -> size_t {
+    return count_left;
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto Range<Index>::at_unchecked(const size_t i) const -> Item {
+    return static_cast<Index>(current_index + i);
+}
+
+template <class Index>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Range<Index>::fold(Acc init, G &&g) -> Acc {
+    auto acc = std::move(init);
+
+    for (; count_left > 0; --count_left) {
+        acc = g(std::move(acc), current_index++);
+    }
+
+    return acc;
+}
+
+template <class Index>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Range<Index>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    auto acc = std::move(init);
+
+    while (count_left > 0) {
+        --count_left;
+        auto res = g(std::move(acc), current_index++);
+
+        if (res.is_err()) {
+            return res;
+        }
+
+        acc = std::move(res).unwrap_unchecked();
+    }
+
+    return Ok(std::move(acc));
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto Range<Index>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    const auto step = std::min(n, count_left);
+
+    current_index += static_cast<Index>(step);
+    count_left -= step;
+
+    if (step < n) {
+        return Err(n - step);
+    }
+
+    return Ok(Unit);
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto Range<Index>::next_back() -> Option<Item> {
+    if (count_left > 0) {
+        --count_left;
+        return Some(static_cast<Index>(current_index + count_left));
+    } else {
+        return None;
+    }
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto Range<Index>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    const auto step = std::min(n, count_left);
+    count_left -= step;
+
+    if (step < n) {
+        return Err(n - step);
+    }
+
+    return Ok(Unit);
+}
+
+namespace details {
+// index that is n steps away, which wraps around for unsigned Index if step
+// is negative
+template <class Index>
+RUSTFP_CONSTEXPR auto step_index(
+    const Index index, const std::ptrdiff_t step, const size_t n) -> Index {
+
+    return static_cast<Index>(
+        index + static_cast<Index>(step * static_cast<std::ptrdiff_t>(n)));
+}
+} // namespace details
+
+template <class Index>
+RUSTFP_CONSTEXPR StepRange<Index>::StepRange(
+    const Index current_index,
+    const size_t count_left,
+    const std::ptrdiff_t step)
+    : current_index(current_index), count_left(count_left), step(step) {
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::next() -> Option<Item> {
+    if (count_left > 0) {
+        --count_left;
+        const auto index = current_index;
+        current_index = details::step_index(current_index, step, 1);
+        return Some(index);
+    } else {
+        return None;
+    }
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(count_left);
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::len() const -> size_t {
+    return count_left;
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::at_unchecked(const size_t i) const
+    -> Item {
+
+    return details::step_index(current_index, step, i);
+}
+
+template <class Index>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto StepRange<Index>::fold(Acc init, G &&g) -> Acc {
+    auto acc = std::move(init);
+
+    for (size_t i = 0; i < count_left; ++i) {
+        acc = g(std::move(acc), details::step_index(current_index, step, i));
+    }
+
+    current_index = details::step_index(current_index, step, count_left);
+    count_left = 0;
+    return acc;
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    const auto count = std::min(n, count_left);
+
+    current_index = details::step_index(current_index, step, count);
+    count_left -= count;
+
+    if (count < n) {
+        return Err(n - count);
+    }
+
+    return Ok(Unit);
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::next_back() -> Option<Item> {
+    if (count_left > 0) {
+        --count_left;
+        return Some(details::step_index(current_index, step, count_left));
+    } else {
+        return None;
+    }
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto StepRange<Index>::advance_back_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    const auto count = std::min(n, count_left);
+    count_left -= count;
+
+    if (count < n) {
+        return Err(n - count);
+    }
+
+    return Ok(Unit);
+}
+
+template <class Index>
+RUSTFP_CONSTEXPR auto range(const Index start_index, const size_t count)
+    -> Range<Index> {
+
     return Range<Index>(start_index, count);
 }
+
+template <class Index>
+RUSTFP_CONSTEXPR auto range(
+    const Index start_index, const size_t count, const std::ptrdiff_t step)
+    -> StepRange<Index> {
+
+    return StepRange<Index>(start_index, count, step);
+}
 } // namespace rustfp
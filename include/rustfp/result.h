@@ -9,8 +9,6 @@
 
 #pragma once
 
-#include "mpark/variant.hpp"
-
 #include "option_fwd.h"
 #include "result_fwd.h"
 #include "specs.h"
@@ -18,6 +16,9 @@
 #include "unit.h"
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -25,18 +26,31 @@ namespace rustfp {
 
 // declaration section
 
+namespace details {
+struct ok_tag_t {};
+struct err_tag_t {};
+
+template <class T, class E>
+class ResultStorage;
+} // namespace details
+
 /**
  * Simulates the Rust Result enum.
  *
  * Wraps either a valid or error value/reference and provides various monadic
  * operations on the wrapped item.
+ *
+ * If either T or E is unit_t, only the other item is stored, with the same
+ * layout as Option of it. Result<unit_t, E> is therefore as large as E if E
+ * has a sentinel value declared via option_niche<E>.
  * @param T Ok item type to wrap over
  * @param E Err item type to wrap over
  */
 template <class T, class E>
 class Result {
 private:
-    using variant_t = mpark::variant<OkImpl<T>, ErrImpl<E>>;
+    using storage_t =
+        details::ResultStorage<reverse_decay_t<T>, reverse_decay_t<E>>;
 
 public:
     /**
@@ -51,25 +65,41 @@ public:
 
     template <class Tx>
     RUSTFP_CONSTEXPR Result(OkImpl<Tx> &&value) RUSTFP_NOEXCEPT_EXPR(
-        std::is_nothrow_move_constructible<variant_t>::value);
+        std::is_nothrow_move_constructible<storage_t>::value);
 
     template <class Ex>
     RUSTFP_CONSTEXPR Result(ErrImpl<Ex> &&err) RUSTFP_NOEXCEPT_EXPR(
-        std::is_nothrow_move_constructible<variant_t>::value);
+        std::is_nothrow_move_constructible<storage_t>::value);
+
+    /**
+     * Constructs the Ok item in place from the given arguments, without any
+     * intermediate move. Prefer make_ok over calling this directly.
+     * @see make_ok
+     */
+    template <class... Args>
+    RUSTFP_CONSTEXPR explicit Result(details::ok_tag_t, Args &&... args);
+
+    /**
+     * Constructs the Err item in place from the given arguments, without any
+     * intermediate move. Prefer make_err over calling this directly.
+     * @see make_err
+     */
+    template <class... Args>
+    RUSTFP_CONSTEXPR explicit Result(details::err_tag_t, Args &&... args);
 
     template <class Tx>
     RUSTFP_CONSTEXPR auto operator=(OkImpl<Tx> &&value)
-        RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<variant_t>::value)
+        RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<storage_t>::value)
             -> Result<T, E> &;
 
     template <class Ex>
     RUSTFP_CONSTEXPR auto operator=(ErrImpl<Ex> &&err)
-        RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<variant_t>::value)
+        RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<storage_t>::value)
             -> Result<T, E> &;
 
-    auto unwrap_unchecked() && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_unchecked() && -> T;
 
-    auto unwrap_err_unchecked() && -> E;
+    RUSTFP_CONSTEXPR auto unwrap_err_unchecked() && -> E;
 
     RUSTFP_CONSTEXPR auto get_unchecked() const RUSTFP_NOEXCEPT
         -> std::add_lvalue_reference_t<
@@ -86,26 +116,28 @@ public:
         -> std::add_lvalue_reference_t<std::remove_reference_t<E>>;
 
     template <class OkFn, class ErrFn>
-    auto match(OkFn &&ok_fn, ErrFn &&err_fn) && -> std::common_type_t<
+    RUSTFP_CONSTEXPR auto
+    match(OkFn &&ok_fn, ErrFn &&err_fn) && -> std::common_type_t<
         std::result_of_t<OkFn(ok_t)>,
         std::result_of_t<ErrFn(err_t)>>;
 
     template <class OkFn, class ErrFn>
-    auto match(OkFn &&ok_fn, ErrFn &&err_fn) const & -> std::common_type_t<
-        std::result_of_t<OkFn(const ok_t &)>,
-        std::result_of_t<ErrFn(const err_t &)>>;
+    RUSTFP_CONSTEXPR auto match(OkFn &&ok_fn, ErrFn &&err_fn)
+        const & -> std::common_type_t<
+            std::result_of_t<OkFn(const ok_t &)>,
+            std::result_of_t<ErrFn(const err_t &)>>;
 
     template <class OkFn>
-    auto match_ok(OkFn &&ok_fn) && -> unit_t;
+    RUSTFP_CONSTEXPR auto match_ok(OkFn &&ok_fn) && -> unit_t;
 
     template <class OkFn>
-    auto match_ok(OkFn &&ok_fn) const & -> unit_t;
+    RUSTFP_CONSTEXPR auto match_ok(OkFn &&ok_fn) const & -> unit_t;
 
     template <class ErrFn>
-    auto match_err(ErrFn &&err_fn) && -> unit_t;
+    RUSTFP_CONSTEXPR auto match_err(ErrFn &&err_fn) && -> unit_t;
 
     template <class ErrFn>
-    auto match_err(ErrFn &&err_fn) const & -> unit_t;
+    RUSTFP_CONSTEXPR auto match_err(ErrFn &&err_fn) const & -> unit_t;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.is_ok
@@ -135,7 +167,7 @@ public:
      * Converts self into an Option<T>, consuming self, and discarding the
      * error, if any.
      */
-    auto ok() && -> Option<T>;
+    RUSTFP_CONSTEXPR auto ok() && -> Option<T>;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.err
@@ -147,7 +179,7 @@ public:
      * Converts self into an Option<E>, consuming self, and discarding the
      * success value, if any.
      */
-    auto err() && -> Option<E>;
+    RUSTFP_CONSTEXPR auto err() && -> Option<E>;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.map
@@ -162,7 +194,7 @@ public:
      * This function can be used to compose the results of two functions.
      */
     template <class F>
-    auto
+    RUSTFP_CONSTEXPR auto
     map(F &&op) && -> Result<special_decay_t<std::result_of_t<F(T &&)>>, E>;
 
     /**
@@ -179,7 +211,7 @@ public:
      * handling an error.
      */
     template <class O>
-    auto
+    RUSTFP_CONSTEXPR auto
     map_err(O &&op) && -> Result<T, special_decay_t<std::result_of_t<O(E &&)>>>;
 
     /**
@@ -190,7 +222,7 @@ public:
      * Returns res if the result is Ok, otherwise returns the Err value of self.
      */
     template <class U>
-    auto and_(Result<U, E> &&res) && -> Result<U, E>;
+    RUSTFP_CONSTEXPR auto and_(Result<U, E> &&res) && -> Result<U, E>;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.and_then
@@ -204,7 +236,7 @@ public:
      * This function can be used for control flow based on Result values.
      */
     template <class F>
-    auto
+    RUSTFP_CONSTEXPR auto
     and_then(F &&op) && -> Result<typename std::result_of_t<F(T &&)>::ok_t, E>;
 
     /**
@@ -215,7 +247,7 @@ public:
      * Returns res if the result is Err, otherwise returns the Ok value of self.
      */
     template <class F>
-    auto or_(Result<T, F> &&res) && -> Result<T, F>;
+    RUSTFP_CONSTEXPR auto or_(Result<T, F> &&res) && -> Result<T, F>;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.or_else
@@ -229,7 +261,7 @@ public:
      * This function can be used for control flow based on result values.
      */
     template <class O>
-    auto
+    RUSTFP_CONSTEXPR auto
     or_else(O &&op) && -> Result<T, typename std::result_of_t<O(E &&)>::err_t>;
 
     /**
@@ -240,7 +272,7 @@ public:
      * Unwraps a result, yielding the content of an Ok. Else, it returns optb.
      */
     template <class Tx>
-    auto unwrap_or(Tx &&optb) && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_or(Tx &&optb) && -> T;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.unwrap_or_else
@@ -253,7 +285,7 @@ public:
      * then it calls op with its value.
      */
     template <class F>
-    auto unwrap_or_else(F &&op) && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_or_else(F &&op) && -> T;
 
     /**
      * https://doc.rust-lang.org/std/result/enum.Result.html#method.unwrap_or_default
@@ -265,10 +297,10 @@ public:
      * Consumes the self argument then, if Ok, returns the contained value,
      * otherwise if Err, returns the default value for that type.
      */
-    auto unwrap_or_default() && -> T;
+    RUSTFP_CONSTEXPR auto unwrap_or_default() && -> T;
 
 private:
-    variant_t value_err;
+    storage_t storage;
 };
 
 template <class T>
@@ -333,93 +365,607 @@ RUSTFP_CONSTEXPR auto Err(E &&error) RUSTFP_NOEXCEPT_EXPR(
     std::is_nothrow_constructible<ErrImpl<special_decay_t<E>>>::value)
     -> ErrImpl<special_decay_t<E>>;
 
+/**
+ * Generates a new Result with the Ok item constructed in place from the given
+ * arguments, unlike Ok, which moves the given item through the intermediate
+ * OkImpl wrapper.
+ *
+ * Returning a Result of an item that cannot be moved requires C++17
+ * guaranteed copy elision.
+ * @param args arguments to construct the Ok item with
+ */
+template <class T, class E, class... Args>
+RUSTFP_CONSTEXPR auto make_ok(Args &&... args) -> Result<T, E>;
+
+/**
+ * Generates a new Result with the Err item constructed in place from the
+ * given arguments, unlike Err, which moves the given item through the
+ * intermediate ErrImpl wrapper.
+ *
+ * Returning a Result of an item that cannot be moved requires C++17
+ * guaranteed copy elision.
+ * @param args arguments to construct the Err item with
+ */
+template <class T, class E, class... Args>
+RUSTFP_CONSTEXPR auto make_err(Args &&... args) -> Result<T, E>;
+
 template <class OkFn, class ErrFn>
-auto res_if_else(const bool cond, OkFn &&ok_fn, ErrFn &&err_fn)
+RUSTFP_CONSTEXPR auto res_if_else(const bool cond, OkFn &&ok_fn, ErrFn &&err_fn)
     -> Result<std::result_of_t<OkFn()>, std::result_of_t<ErrFn()>>;
 
-// implementation section
-
 namespace details {
+/**
+ * Moves the error out of the given Result into Err, for propagating the error
+ * into another Result type. Marked as cold, so that the error construction is
+ * not laid out within the Ok path of the caller.
+ * @tparam T Ok type of res
+ * @tparam E Err type of res
+ * @param res Result that must contain Err
+ * @return Err containing the moved error of res
+ */
 template <class T, class E>
-RUSTFP_CONSTEXPR auto get_unchecked(
-    const mpark::variant<OkImpl<T>, ErrImpl<E>> &value_err) RUSTFP_NOEXCEPT
-    -> std::add_lvalue_reference_t<
-        std::add_const_t<std::remove_reference_t<T>>> {
+RUSTFP_COLD RUSTFP_CONSTEXPR auto forward_err(Result<T, E> &&res)
+    -> ErrImpl<E>;
+} // namespace details
 
-    return mpark::get_if<OkImpl<T>>(&value_err)->get();
+// implementation section
+
+namespace details {
+enum class result_tag_t : uint8_t { Ok, Err };
+
+struct uninit_tag_t {};
+
+// placement new that is usable in constant expressions from C++20 onwards
+template <class T, class... Args>
+RUSTFP_CONSTEXPR_CXX20 void construct_at(T *ptr, Args &&... args) {
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+    std::construct_at(ptr, std::forward<Args>(args)...);
+#else
+    ::new (static_cast<void *>(ptr)) T(std::forward<Args>(args)...);
+#endif
 }
 
-template <class T, class E>
-RUSTFP_CONSTEXPR auto get_mut_unchecked(
-    mpark::variant<OkImpl<T>, ErrImpl<E>> &value_err) RUSTFP_NOEXCEPT
-    -> std::add_lvalue_reference_t<std::remove_reference_t<T>> {
+// T and E in a union with a 1-byte tag, which is trivially destructible if
+// both T and E are
+template <
+    class T,
+    class E,
+    bool = std::is_trivially_destructible<T>::value
+           && std::is_trivially_destructible<E>::value>
+class ResultUnion {
+public:
+    template <class... Args>
+    RUSTFP_CONSTEXPR ResultUnion(ok_tag_t, Args &&... args)
+        : ok(std::forward<Args>(args)...), tag(result_tag_t::Ok) {
+    }
 
-    return mpark::get_if<OkImpl<T>>(&value_err)->get_mut();
-}
+    template <class... Args>
+    RUSTFP_CONSTEXPR ResultUnion(err_tag_t, Args &&... args)
+        : err(std::forward<Args>(args)...), tag(result_tag_t::Err) {
+    }
+
+protected:
+    // tag and the active member are to be set by the caller
+    RUSTFP_CONSTEXPR ResultUnion(uninit_tag_t) RUSTFP_NOEXCEPT
+        : uninit(),
+          tag(result_tag_t::Ok) {
+    }
+
+    RUSTFP_CONSTEXPR void destroy() RUSTFP_NOEXCEPT {
+    }
+
+    union {
+        unit_t uninit;
+        T ok;
+        E err;
+    };
+
+    result_tag_t tag;
+};
 
 template <class T, class E>
-RUSTFP_CONSTEXPR auto get_err_unchecked(
-    const mpark::variant<OkImpl<T>, ErrImpl<E>> &value_err) RUSTFP_NOEXCEPT
-    -> std::add_lvalue_reference_t<
-        std::add_const_t<std::remove_reference_t<E>>> {
+class ResultUnion<T, E, false> {
+public:
+    template <class... Args>
+    RUSTFP_CONSTEXPR_CXX20 ResultUnion(ok_tag_t, Args &&... args)
+        : ok(std::forward<Args>(args)...), tag(result_tag_t::Ok) {
+    }
 
-    return mpark::get_if<ErrImpl<E>>(&value_err)->get();
-}
+    template <class... Args>
+    RUSTFP_CONSTEXPR_CXX20 ResultUnion(err_tag_t, Args &&... args)
+        : err(std::forward<Args>(args)...), tag(result_tag_t::Err) {
+    }
+
+    RUSTFP_CONSTEXPR_CXX20 ~ResultUnion() {
+        destroy();
+    }
+
+protected:
+    // tag and the active member are to be set by the caller
+    RUSTFP_CONSTEXPR_CXX20 ResultUnion(uninit_tag_t) RUSTFP_NOEXCEPT
+        : uninit(),
+          tag(result_tag_t::Ok) {
+    }
+
+    RUSTFP_CONSTEXPR_CXX20 void destroy() RUSTFP_NOEXCEPT {
+        if (tag == result_tag_t::Ok) {
+            ok.~T();
+        } else {
+            err.~E();
+        }
+    }
 
+    union {
+        unit_t uninit;
+        T ok;
+        E err;
+    };
+
+    result_tag_t tag;
+};
+
+// accessors of ResultUnion used by Result
 template <class T, class E>
-RUSTFP_CONSTEXPR auto get_err_mut_unchecked(
-    mpark::variant<OkImpl<T>, ErrImpl<E>> &value_err) RUSTFP_NOEXCEPT
-    -> std::add_lvalue_reference_t<std::remove_reference_t<E>> {
+class ResultAccess : public ResultUnion<T, E> {
+    using base_t = ResultUnion<T, E>;
 
-    return mpark::get_if<ErrImpl<E>>(&value_err)->get_mut();
-}
+public:
+    using base_t::base_t;
+
+    RUSTFP_CONSTEXPR auto is_ok() const RUSTFP_NOEXCEPT -> bool {
+        return this->tag == result_tag_t::Ok;
+    }
+
+    RUSTFP_CONSTEXPR auto get() const RUSTFP_NOEXCEPT -> const T & {
+        return this->ok;
+    }
+
+    RUSTFP_CONSTEXPR auto get_mut() RUSTFP_NOEXCEPT -> T & {
+        return this->ok;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err() const RUSTFP_NOEXCEPT -> const E & {
+        return this->err;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err_mut() RUSTFP_NOEXCEPT -> E & {
+        return this->err;
+    }
+
+    RUSTFP_CONSTEXPR auto move_ok() RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<T>::value) -> T {
+
+        return std::move(this->ok);
+    }
+
+    RUSTFP_CONSTEXPR auto move_err() RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<E>::value) -> E {
+
+        return std::move(this->err);
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR_CXX20 void emplace(ok_tag_t, Tx &&value) {
+        emplace_impl(
+            &this->ok,
+            result_tag_t::Ok,
+            std::forward<Tx>(value),
+            std::is_nothrow_constructible<T, Tx &&>());
+    }
+
+    template <class Ex>
+    RUSTFP_CONSTEXPR_CXX20 void emplace(err_tag_t, Ex &&err) {
+        emplace_impl(
+            &this->err,
+            result_tag_t::Err,
+            std::forward<Ex>(err),
+            std::is_nothrow_constructible<E, Ex &&>());
+    }
+
+protected:
+    template <class Rhs>
+    RUSTFP_CONSTEXPR_CXX20 void construct_from(Rhs &&rhs) {
+        if (rhs.is_ok()) {
+            details::construct_at(&this->ok, std::forward<Rhs>(rhs).ok);
+        } else {
+            details::construct_at(&this->err, std::forward<Rhs>(rhs).err);
+        }
+
+        this->tag = rhs.tag;
+    }
+
+    template <class Rhs>
+    RUSTFP_CONSTEXPR_CXX20 void assign_from(Rhs &&rhs) {
+        if (this->tag != rhs.tag) {
+            rhs.is_ok() ? emplace(ok_tag_t{}, std::forward<Rhs>(rhs).ok)
+                        : emplace(err_tag_t{}, std::forward<Rhs>(rhs).err);
+        } else if (rhs.is_ok()) {
+            this->ok = std::forward<Rhs>(rhs).ok;
+        } else {
+            this->err = std::forward<Rhs>(rhs).err;
+        }
+    }
+
+private:
+    // nothing may throw between destroying the current value and setting the
+    // new tag, otherwise the tag would still name the destroyed member, so
+    // the new value is constructed in place only if that cannot throw
+    template <class U, class Ux>
+    RUSTFP_CONSTEXPR_CXX20 void emplace_impl(
+        U *member, const result_tag_t tag, Ux &&value, std::true_type) {
+
+        this->destroy();
+        details::construct_at(member, std::forward<Ux>(value));
+        this->tag = tag;
+    }
+
+    // otherwise the new value is constructed aside first, and then moved in
+    template <class U, class Ux>
+    RUSTFP_CONSTEXPR_CXX20 void emplace_impl(
+        U *member, const result_tag_t tag, Ux &&value, std::false_type) {
+
+        static_assert(
+            std::is_nothrow_move_constructible<U>::value,
+            "Result can only switch between Ok and Err if the new item is "
+            "nothrow constructible from the value, or nothrow move "
+            "constructible");
+
+        U new_value(std::forward<Ux>(value));
+        this->destroy();
+        details::construct_at(member, std::move(new_value));
+        this->tag = tag;
+    }
+};
+
+// ResultAccess whose copy and move members switch the active member, which
+// are all trivial if both T and E are trivially copyable
+template <
+    class T,
+    class E,
+    bool = std::is_trivially_copyable<T>::value
+           && std::is_trivially_copyable<E>::value>
+class ResultCopyMove : public ResultAccess<T, E> {
+public:
+    using ResultAccess<T, E>::ResultAccess;
+
+    // replaces the whole union instead of switching the active member in
+    // place, which keeps emplace usable in constant expressions before C++20
+    template <class Tx>
+    RUSTFP_CONSTEXPR void emplace(ok_tag_t, Tx &&value) {
+        *this = ResultCopyMove(ok_tag_t{}, std::forward<Tx>(value));
+    }
+
+    template <class Ex>
+    RUSTFP_CONSTEXPR void emplace(err_tag_t, Ex &&err) {
+        *this = ResultCopyMove(err_tag_t{}, std::forward<Ex>(err));
+    }
+};
 
 template <class T, class E>
-auto move_unchecked(mpark::variant<OkImpl<T>, ErrImpl<E>> &&value_err)
-    -> reverse_decay_t<T> {
+class ResultCopyMove<T, E, false> : public ResultAccess<T, E> {
+    using base_t = ResultAccess<T, E>;
 
-    return std::move(*mpark::get_if<OkImpl<T>>(&value_err)).move();
-}
+public:
+    using base_t::base_t;
+
+    RUSTFP_CONSTEXPR_CXX20 ResultCopyMove(const ResultCopyMove &rhs)
+        : base_t(uninit_tag_t{}) {
+
+        this->construct_from(rhs);
+    }
+
+    RUSTFP_CONSTEXPR_CXX20 ResultCopyMove(ResultCopyMove &&rhs)
+        RUSTFP_NOEXCEPT_EXPR(
+            std::is_nothrow_move_constructible<T>::value
+            && std::is_nothrow_move_constructible<E>::value)
+        : base_t(uninit_tag_t{}) {
+
+        this->construct_from(std::move(rhs));
+    }
+
+    RUSTFP_CONSTEXPR_CXX20 auto operator=(const ResultCopyMove &rhs)
+        -> ResultCopyMove & {
 
+        this->assign_from(rhs);
+        return *this;
+    }
+
+    RUSTFP_CONSTEXPR_CXX20 auto operator=(ResultCopyMove &&rhs)
+        RUSTFP_NOEXCEPT_EXPR(
+            std::is_nothrow_move_constructible<T>::value
+            && std::is_nothrow_move_constructible<E>::value
+            && std::is_nothrow_move_assignable<T>::value
+            && std::is_nothrow_move_assignable<E>::value) -> ResultCopyMove & {
+
+        this->assign_from(std::move(rhs));
+        return *this;
+    }
+};
+
+// deletes the copy members of ResultStorage if either T or E is not copyable
+template <bool Copyable>
+struct ResultCopyControl {};
+
+template <>
+struct ResultCopyControl<false> {
+    ResultCopyControl() = default;
+    ResultCopyControl(const ResultCopyControl &) = delete;
+    ResultCopyControl(ResultCopyControl &&) = default;
+    auto operator=(const ResultCopyControl &) -> ResultCopyControl & = delete;
+    auto operator=(ResultCopyControl &&) -> ResultCopyControl & = default;
+};
+
+// two-state tagged union of Result
 template <class T, class E>
-auto move_err_unchecked(mpark::variant<OkImpl<T>, ErrImpl<E>> &&value_err)
-    -> reverse_decay_t<E> {
+class ResultStorage
+    : public ResultCopyMove<T, E>,
+      private ResultCopyControl<
+          std::is_copy_constructible<T>::value
+          && std::is_copy_constructible<E>::value> {
 
-    return std::move(*mpark::get_if<ErrImpl<E>>(&value_err)).move();
-}
+public:
+    using ResultCopyMove<T, E>::ResultCopyMove;
+};
+
+// mutable unit_t referred to by the unit side of Result, which holds no state
+template <class Tag = void>
+struct ResultUnit {
+    static unit_t value;
+};
+
+template <class Tag>
+unit_t ResultUnit<Tag>::value = Unit;
+
+// Result<T, unit_t> and Result<unit_t, E> stored as the Option storage of the
+// non-unit item alone, where None represents the unit side. The storage does
+// not reset on move, and uses the option_niche<T> sentinel if declared.
+template <class T>
+class ResultUnitStorage {
+    using opt_t = typename option_storage_impl<T>::value_type;
+
+public:
+    RUSTFP_CONSTEXPR ResultUnitStorage() : opt() {
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR ResultUnitStorage(some_tag_t, Tx &&value)
+        : opt(std::forward<Tx>(value)) {
+    }
+
+    // the raw nonstd::optional storage takes no some_tag_t
+    template <class... Args>
+    RUSTFP_CONSTEXPR ResultUnitStorage(some_tag_t, Args &&... args) : opt() {
+        opt.emplace(std::forward<Args>(args)...);
+    }
+
+    RUSTFP_CONSTEXPR auto is_some() const RUSTFP_NOEXCEPT -> bool {
+        return opt.has_value();
+    }
+
+    RUSTFP_CONSTEXPR auto get() const RUSTFP_NOEXCEPT -> const T & {
+        return *opt;
+    }
+
+    RUSTFP_CONSTEXPR auto get_mut() RUSTFP_NOEXCEPT -> T & {
+        return *opt;
+    }
+
+    RUSTFP_CONSTEXPR auto move() RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<T>::value) -> T {
+
+        return std::move(*opt);
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR void emplace(Tx &&value) {
+        opt = std::forward<Tx>(value);
+    }
+
+    RUSTFP_CONSTEXPR void reset() RUSTFP_NOEXCEPT {
+        opt.reset();
+    }
+
+private:
+    opt_t opt;
+};
+
+template <class T>
+class ResultStorage<T, unit_t> : private ResultUnitStorage<T> {
+    using base_t = ResultUnitStorage<T>;
+
+public:
+    template <class... Args>
+    RUSTFP_CONSTEXPR ResultStorage(ok_tag_t, Args &&... args)
+        : base_t(some_tag_t{}, std::forward<Args>(args)...) {
+    }
+
+    RUSTFP_CONSTEXPR ResultStorage(err_tag_t, unit_t = Unit) : base_t() {
+    }
+
+    RUSTFP_CONSTEXPR auto is_ok() const RUSTFP_NOEXCEPT -> bool {
+        return this->is_some();
+    }
+
+    using base_t::get;
+    using base_t::get_mut;
+
+    RUSTFP_CONSTEXPR auto get_err() const RUSTFP_NOEXCEPT -> const unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err_mut() RUSTFP_NOEXCEPT -> unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto move_ok() RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<T>::value) -> T {
+
+        return this->move();
+    }
+
+    RUSTFP_CONSTEXPR auto move_err() RUSTFP_NOEXCEPT -> unit_t {
+        return Unit;
+    }
+
+    template <class Tx>
+    RUSTFP_CONSTEXPR void emplace(ok_tag_t, Tx &&value) {
+        base_t::emplace(std::forward<Tx>(value));
+    }
+
+    RUSTFP_CONSTEXPR void emplace(err_tag_t, unit_t) RUSTFP_NOEXCEPT {
+        this->reset();
+    }
+};
+
+template <class E>
+class ResultStorage<unit_t, E> : private ResultUnitStorage<E> {
+    using base_t = ResultUnitStorage<E>;
+
+public:
+    RUSTFP_CONSTEXPR ResultStorage(ok_tag_t, unit_t = Unit) : base_t() {
+    }
+
+    template <class... Args>
+    RUSTFP_CONSTEXPR ResultStorage(err_tag_t, Args &&... args)
+        : base_t(some_tag_t{}, std::forward<Args>(args)...) {
+    }
+
+    RUSTFP_CONSTEXPR auto is_ok() const RUSTFP_NOEXCEPT -> bool {
+        return !this->is_some();
+    }
+
+    RUSTFP_CONSTEXPR auto get() const RUSTFP_NOEXCEPT -> const unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_mut() RUSTFP_NOEXCEPT -> unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err() const RUSTFP_NOEXCEPT -> const E & {
+        return base_t::get();
+    }
+
+    RUSTFP_CONSTEXPR auto get_err_mut() RUSTFP_NOEXCEPT -> E & {
+        return base_t::get_mut();
+    }
+
+    RUSTFP_CONSTEXPR auto move_ok() RUSTFP_NOEXCEPT -> unit_t {
+        return Unit;
+    }
+
+    RUSTFP_CONSTEXPR auto move_err() RUSTFP_NOEXCEPT_EXPR(
+        std::is_nothrow_move_constructible<E>::value) -> E {
+
+        return this->move();
+    }
+
+    RUSTFP_CONSTEXPR void emplace(ok_tag_t, unit_t) RUSTFP_NOEXCEPT {
+        this->reset();
+    }
+
+    template <class Ex>
+    RUSTFP_CONSTEXPR void emplace(err_tag_t, Ex &&err) {
+        base_t::emplace(std::forward<Ex>(err));
+    }
+};
+
+// Result<unit_t, unit_t> is stored as the tag alone
+template <>
+class ResultStorage<unit_t, unit_t> {
+public:
+    RUSTFP_CONSTEXPR ResultStorage(ok_tag_t, unit_t = Unit) RUSTFP_NOEXCEPT
+        : tag(result_tag_t::Ok) {
+    }
+
+    RUSTFP_CONSTEXPR ResultStorage(err_tag_t, unit_t = Unit) RUSTFP_NOEXCEPT
+        : tag(result_tag_t::Err) {
+    }
+
+    RUSTFP_CONSTEXPR auto is_ok() const RUSTFP_NOEXCEPT -> bool {
+        return tag == result_tag_t::Ok;
+    }
+
+    RUSTFP_CONSTEXPR auto get() const RUSTFP_NOEXCEPT -> const unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_mut() RUSTFP_NOEXCEPT -> unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err() const RUSTFP_NOEXCEPT -> const unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto get_err_mut() RUSTFP_NOEXCEPT -> unit_t & {
+        return ResultUnit<>::value;
+    }
+
+    RUSTFP_CONSTEXPR auto move_ok() RUSTFP_NOEXCEPT -> unit_t {
+        return Unit;
+    }
+
+    RUSTFP_CONSTEXPR auto move_err() RUSTFP_NOEXCEPT -> unit_t {
+        return Unit;
+    }
+
+    RUSTFP_CONSTEXPR void emplace(ok_tag_t, unit_t) RUSTFP_NOEXCEPT {
+        tag = result_tag_t::Ok;
+    }
+
+    RUSTFP_CONSTEXPR void emplace(err_tag_t, unit_t) RUSTFP_NOEXCEPT {
+        tag = result_tag_t::Err;
+    }
+
+private:
+    result_tag_t tag;
+};
 } // namespace details
 
 template <class T, class E>
 template <class Tx>
 RUSTFP_CONSTEXPR Result<T, E>::Result(OkImpl<Tx> &&value)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_constructible<variant_t>::value)
-    : value_err(OkImpl<T>(std::move(value).move())) {
+    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_constructible<storage_t>::value)
+    : storage(details::ok_tag_t{}, std::move(value).move()) {
 }
 
 template <class T, class E>
 template <class Ex>
 RUSTFP_CONSTEXPR Result<T, E>::Result(ErrImpl<Ex> &&err)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_constructible<variant_t>::value)
-    : value_err(ErrImpl<E>(std::move(err).move())) {
+    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_constructible<storage_t>::value)
+    : storage(details::err_tag_t{}, std::move(err).move()) {
+}
+
+template <class T, class E>
+template <class... Args>
+RUSTFP_CONSTEXPR Result<T, E>::Result(details::ok_tag_t, Args &&... args)
+    : storage(details::ok_tag_t{}, std::forward<Args>(args)...) {
+}
+
+template <class T, class E>
+template <class... Args>
+RUSTFP_CONSTEXPR Result<T, E>::Result(details::err_tag_t, Args &&... args)
+    : storage(details::err_tag_t{}, std::forward<Args>(args)...) {
 }
 
 template <class T, class E>
 template <class Tx>
 RUSTFP_CONSTEXPR auto Result<T, E>::operator=(OkImpl<Tx> &&value)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<variant_t>::value)
+    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<storage_t>::value)
         -> Result<T, E> & {
 
-    value_err = OkImpl<T>(std::move(value).move());
+    storage.emplace(details::ok_tag_t{}, std::move(value).move());
     return *this;
 }
 
 template <class T, class E>
 template <class Ex>
 RUSTFP_CONSTEXPR auto Result<T, E>::operator=(ErrImpl<Ex> &&err)
-    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<variant_t>::value)
+    RUSTFP_NOEXCEPT_EXPR(std::is_nothrow_move_assignable<storage_t>::value)
         -> Result<T, E> & {
 
-    value_err = ErrImpl<E>(std::move(err).move());
+    storage.emplace(details::err_tag_t{}, std::move(err).move());
     return *this;
 }
 
@@ -429,7 +975,7 @@ RUSTFP_CONSTEXPR auto Result<T, E>::get_unchecked() const RUSTFP_NOEXCEPT
         std::add_const_t<std::remove_reference_t<T>>> {
 
     assert(is_ok());
-    return details::get_unchecked(value_err);
+    return storage.get();
 }
 
 template <class T, class E>
@@ -437,7 +983,7 @@ RUSTFP_CONSTEXPR auto Result<T, E>::get_mut_unchecked() RUSTFP_NOEXCEPT
     -> std::add_lvalue_reference_t<std::remove_reference_t<T>> {
 
     assert(is_ok());
-    return details::get_mut_unchecked(value_err);
+    return storage.get_mut();
 }
 
 template <class T, class E>
@@ -446,7 +992,7 @@ RUSTFP_CONSTEXPR auto Result<T, E>::get_err_unchecked() const RUSTFP_NOEXCEPT
         std::add_const_t<std::remove_reference_t<E>>> {
 
     assert(is_err());
-    return details::get_err_unchecked(value_err);
+    return storage.get_err();
 }
 
 template <class T, class E>
@@ -454,53 +1000,54 @@ RUSTFP_CONSTEXPR auto Result<T, E>::get_err_mut_unchecked() RUSTFP_NOEXCEPT
     -> std::add_lvalue_reference_t<std::remove_reference_t<E>> {
 
     assert(is_err());
-    return details::get_err_mut_unchecked(value_err);
+    return storage.get_err_mut();
 }
 
 template <class T, class E>
-auto Result<T, E>::unwrap_unchecked() && -> T {
+RUSTFP_CONSTEXPR auto Result<T, E>::unwrap_unchecked() && -> T {
     assert(is_ok());
 
     // reference_wrapper can be implicitly converted to direct reference
     // if T is a reference type
-    return details::move_unchecked(std::move(value_err));
+    return storage.move_ok();
 }
 
 template <class T, class E>
-auto Result<T, E>::unwrap_err_unchecked() && -> E {
+RUSTFP_CONSTEXPR auto Result<T, E>::unwrap_err_unchecked() && -> E {
     assert(is_err());
 
     // reference_wrapper can be implicitly converted to direct reference
     // if E is a reference type
-    return details::move_err_unchecked(std::move(value_err));
+    return storage.move_err();
 }
 
 template <class T, class E>
 template <class OkFn, class ErrFn>
-auto Result<T, E>::match(OkFn &&ok_fn, ErrFn &&err_fn) && -> std::common_type_t<
-    std::result_of_t<OkFn(ok_t)>,
-    std::result_of_t<ErrFn(err_t)>> {
+RUSTFP_CONSTEXPR auto Result<T, E>::match(OkFn &&ok_fn, ErrFn &&err_fn)
+    && -> std::common_type_t<
+        std::result_of_t<OkFn(ok_t)>,
+        std::result_of_t<ErrFn(err_t)>> {
 
-    return is_ok() ? ok_fn(details::move_unchecked(std::move(value_err)))
-                   : err_fn(details::move_err_unchecked(std::move(value_err)));
+    return RUSTFP_LIKELY(is_ok()) ? ok_fn(storage.move_ok())
+                                  : err_fn(storage.move_err());
 }
 
 template <class T, class E>
 template <class OkFn, class ErrFn>
-auto Result<T, E>::match(OkFn &&ok_fn, ErrFn &&err_fn)
+RUSTFP_CONSTEXPR auto Result<T, E>::match(OkFn &&ok_fn, ErrFn &&err_fn)
     const & -> std::common_type_t<
         std::result_of_t<OkFn(const ok_t &)>,
         std::result_of_t<ErrFn(const err_t &)>> {
 
-    return is_ok() ? ok_fn(details::get_unchecked(value_err))
-                   : err_fn(details::get_err_unchecked(value_err));
+    return RUSTFP_LIKELY(is_ok()) ? ok_fn(storage.get())
+                                  : err_fn(storage.get_err());
 }
 
 template <class T, class E>
 template <class OkFn>
-auto Result<T, E>::match_ok(OkFn &&ok_fn) && -> unit_t {
-    if (is_ok()) {
-        ok_fn(details::move_unchecked(std::move(value_err)));
+RUSTFP_CONSTEXPR auto Result<T, E>::match_ok(OkFn &&ok_fn) && -> unit_t {
+    if (RUSTFP_LIKELY(is_ok())) {
+        ok_fn(storage.move_ok());
     }
 
     return Unit;
@@ -508,9 +1055,9 @@ auto Result<T, E>::match_ok(OkFn &&ok_fn) && -> unit_t {
 
 template <class T, class E>
 template <class OkFn>
-auto Result<T, E>::match_ok(OkFn &&ok_fn) const & -> unit_t {
-    if (is_ok()) {
-        ok_fn(details::get_unchecked(value_err));
+RUSTFP_CONSTEXPR auto Result<T, E>::match_ok(OkFn &&ok_fn) const & -> unit_t {
+    if (RUSTFP_LIKELY(is_ok())) {
+        ok_fn(storage.get());
     }
 
     return Unit;
@@ -518,9 +1065,9 @@ auto Result<T, E>::match_ok(OkFn &&ok_fn) const & -> unit_t {
 
 template <class T, class E>
 template <class ErrFn>
-auto Result<T, E>::match_err(ErrFn &&err_fn) && -> unit_t {
-    if (is_err()) {
-        err_fn(details::move_err_unchecked(std::move(value_err)));
+RUSTFP_CONSTEXPR auto Result<T, E>::match_err(ErrFn &&err_fn) && -> unit_t {
+    if (RUSTFP_UNLIKELY(is_err())) {
+        err_fn(storage.move_err());
     }
 
     return Unit;
@@ -528,9 +1075,11 @@ auto Result<T, E>::match_err(ErrFn &&err_fn) && -> unit_t {
 
 template <class T, class E>
 template <class ErrFn>
-auto Result<T, E>::match_err(ErrFn &&err_fn) const & -> unit_t {
-    if (is_err()) {
-        err_fn(details::get_err_unchecked(value_err));
+RUSTFP_CONSTEXPR auto Result<T, E>::match_err(ErrFn &&err_fn)
+    const & -> unit_t {
+
+    if (RUSTFP_UNLIKELY(is_err())) {
+        err_fn(storage.get_err());
     }
 
     return Unit;
@@ -538,98 +1087,101 @@ auto Result<T, E>::match_err(ErrFn &&err_fn) const & -> unit_t {
 
 template <class T, class E>
 RUSTFP_CONSTEXPR auto Result<T, E>::is_ok() const RUSTFP_NOEXCEPT -> bool {
-    return value_err.index() == 0;
+    return storage.is_ok();
 }
 
 template <class T, class E>
 RUSTFP_CONSTEXPR auto Result<T, E>::is_err() const RUSTFP_NOEXCEPT -> bool {
-    return value_err.index() == 1;
+    return !storage.is_ok();
 }
 
 template <class T, class E>
-auto Result<T, E>::ok() && -> Option<T> {
-    return is_ok() ? Some(details::move_unchecked(std::move(value_err))) : None;
+RUSTFP_CONSTEXPR auto Result<T, E>::ok() && -> Option<T> {
+    return is_ok() ? Some(storage.move_ok()) : None;
 }
 
 template <class T, class E>
-auto Result<T, E>::err() && -> Option<E> {
-    return is_err() ? Some(details::move_err_unchecked(std::move(value_err)))
-                    : None;
+RUSTFP_CONSTEXPR auto Result<T, E>::err() && -> Option<E> {
+    return is_err() ? Some(storage.move_err()) : None;
 }
 
 template <class T, class E>
 template <class F>
-auto Result<T, E>::map(
+RUSTFP_CONSTEXPR auto Result<T, E>::map(
     F &&op) && -> Result<special_decay_t<std::result_of_t<F(T &&)>>, E> {
 
+    using result_t = Result<special_decay_t<std::result_of_t<F(T &&)>>, E>;
+
     if (is_ok()) {
-        return Ok(op(details::move_unchecked(std::move(value_err))));
+        return result_t(details::ok_tag_t{}, op(storage.move_ok()));
     } else {
-        return Err(details::move_err_unchecked(std::move(value_err)));
+        return Err(storage.move_err());
     }
 }
 
 template <class T, class E>
 template <class O>
-auto Result<T, E>::map_err(
+RUSTFP_CONSTEXPR auto Result<T, E>::map_err(
     O &&op) && -> Result<T, special_decay_t<std::result_of_t<O(E &&)>>> {
 
     if (is_err()) {
-        return Err(op(details::move_err_unchecked(std::move(value_err))));
+        return Err(op(storage.move_err()));
     } else {
-        return Ok(details::move_unchecked(std::move(value_err)));
+        return Ok(storage.move_ok());
     }
 }
 
 template <class T, class E>
 template <class U>
-auto Result<T, E>::and_(Result<U, E> &&res) && -> Result<U, E> {
+RUSTFP_CONSTEXPR auto Result<T, E>::and_(Result<U, E> &&res)
+    && -> Result<U, E> {
+
     if (is_ok()) {
         return std::move(res);
     } else {
-        return Err(details::move_err_unchecked(std::move(value_err)));
+        return Err(storage.move_err());
     }
 }
 
 template <class T, class E>
 template <class F>
-auto Result<T, E>::and_then(
+RUSTFP_CONSTEXPR auto Result<T, E>::and_then(
     F &&op) && -> Result<typename std::result_of_t<F(T &&)>::ok_t, E> {
 
     if (is_ok()) {
-        return op(details::move_unchecked(std::move(value_err)));
+        return op(storage.move_ok());
     } else {
-        return Err(details::move_err_unchecked(std::move(value_err)));
+        return Err(storage.move_err());
     }
 }
 
 template <class T, class E>
 template <class F>
-auto Result<T, E>::or_(Result<T, F> &&res) && -> Result<T, F> {
+RUSTFP_CONSTEXPR auto Result<T, E>::or_(Result<T, F> &&res) && -> Result<T, F> {
     if (is_err()) {
         return std::move(res);
     } else {
-        return Ok(details::move_unchecked(std::move(value_err)));
+        return Ok(storage.move_ok());
     }
 }
 
 template <class T, class E>
 template <class O>
-auto Result<T, E>::or_else(
+RUSTFP_CONSTEXPR auto Result<T, E>::or_else(
     O &&op) && -> Result<T, typename std::result_of_t<O(E &&)>::err_t> {
 
-    if (is_err()) {
-        return op(details::move_err_unchecked(std::move(value_err)));
+    if (RUSTFP_UNLIKELY(is_err())) {
+        return op(storage.move_err());
     } else {
-        return Ok(details::move_unchecked(std::move(value_err)));
+        return Ok(storage.move_ok());
     }
 }
 
 template <class T, class E>
 template <class Tx>
-auto Result<T, E>::unwrap_or(Tx &&optb) && -> T {
+RUSTFP_CONSTEXPR auto Result<T, E>::unwrap_or(Tx &&optb) && -> T {
     if (is_ok()) {
-        return details::move_unchecked(std::move(value_err));
+        return storage.move_ok();
     } else {
         return std::forward<Tx>(optb);
     }
@@ -637,18 +1189,18 @@ auto Result<T, E>::unwrap_or(Tx &&optb) && -> T {
 
 template <class T, class E>
 template <class F>
-auto Result<T, E>::unwrap_or_else(F &&op) && -> T {
-    if (is_ok()) {
-        return details::move_unchecked(std::move(value_err));
+RUSTFP_CONSTEXPR auto Result<T, E>::unwrap_or_else(F &&op) && -> T {
+    if (RUSTFP_LIKELY(is_ok())) {
+        return storage.move_ok();
     } else {
         return op();
     }
 }
 
 template <class T, class E>
-auto Result<T, E>::unwrap_or_default() && -> T {
+RUSTFP_CONSTEXPR auto Result<T, E>::unwrap_or_default() && -> T {
     if (is_ok()) {
-        return details::move_unchecked(std::move(value_err));
+        return storage.move_ok();
     } else {
         return T();
     }
@@ -732,8 +1284,18 @@ RUSTFP_CONSTEXPR auto Err(E &&error) RUSTFP_NOEXCEPT_EXPR(
     return ErrImpl<special_decay_t<E>>(std::forward<E>(error));
 }
 
+template <class T, class E, class... Args>
+RUSTFP_CONSTEXPR auto make_ok(Args &&... args) -> Result<T, E> {
+    return Result<T, E>(details::ok_tag_t{}, std::forward<Args>(args)...);
+}
+
+template <class T, class E, class... Args>
+RUSTFP_CONSTEXPR auto make_err(Args &&... args) -> Result<T, E> {
+    return Result<T, E>(details::err_tag_t{}, std::forward<Args>(args)...);
+}
+
 template <class OkFn, class ErrFn>
-auto res_if_else(const bool cond, OkFn &&ok_fn, ErrFn &&err_fn)
+RUSTFP_CONSTEXPR auto res_if_else(const bool cond, OkFn &&ok_fn, ErrFn &&err_fn)
     -> Result<std::result_of_t<OkFn()>, std::result_of_t<ErrFn()>> {
 
     if (cond) {
@@ -742,6 +1304,18 @@ auto res_if_else(const bool cond, OkFn &&ok_fn, ErrFn &&err_fn)
         return Err(err_fn());
     }
 }
+
+namespace details {
+template <class T, class E>
+RUSTFP_COLD RUSTFP_CONSTEXPR auto forward_err(Result<T, E> &&res)
+    -> ErrImpl<E> {
+
+    // because error type may be a reference
+    // must perform reverse decay here since Err will special
+    // decay the given type
+    return Err(reverse_decay(std::move(res).unwrap_err_unchecked()));
+}
+} // namespace details
 } // namespace rustfp
 
 #include "option.h"
@@ -0,0 +1,177 @@
+/**
+ * Contains Rust Iterator rev equivalent implementation.
+ *
+ * rev function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.rev
+ *
+ * Rev struct: https://doc.rust-lang.org/std/iter/struct.Rev.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "result.h"
+#include "unit.h"
+#include "util.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<I> Iterator for Rev<I>
+ * where
+ *     I: DoubleEndedIterator,
+ * type Item = <I as Iterator>::Item
+ */
+template <class Self>
+class Rev {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = typename Self::Item;
+
+    static_assert(
+        details::is_double_ended<Self>::value,
+        "Rev can only take iterator with next_back method");
+
+    /**
+     * Takes in the moved rustfp Iter instance to iterate in reverse.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     */
+    template <class Selfx>
+    explicit Rev(Selfx &&self);
+
+    /**
+     * Generates the next value from the back of the underlying iterator.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Generates the next value from the front of the underlying iterator.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    auto next_back() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, which is the same as the
+     * underlying iterator.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, which is the same as the
+     * underlying iterator. Only available if the underlying iterator is exact
+     * size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Advances the underlying iterator from the back by n items without
+     * generating them.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Advances the underlying iterator from the front by n items without
+     * generating them.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    auto advance_back_by(const size_t n) -> Result<unit_t, size_t>;
+
+private:
+    Self self;
+};
+
+class RevOp {
+public:
+    template <class Self>
+    auto operator()(Self &&self) && -> Rev<Self>;
+};
+
+/**
+ * fn rev(self) -> Rev<Self>
+ * where
+ *     Self: DoubleEndedIterator,
+ */
+auto rev() -> RevOp;
+
+// implementation section
+
+template <class Self>
+template <class Selfx>
+Rev<Self>::Rev(Selfx &&self) : self(std::forward<Selfx>(self)) {
+}
+
+template <class Self>
+auto Rev<Self>::next() -> Option<Item> {
+    return self.next_back();
+}
+
+template <class Self>
+auto Rev<Self>::next_back() -> Option<Item> {
+    return self.next();
+}
+
+template <class Self>
+auto Rev<Self>::size_hint() const -> size_hint_t {
+    return details::size_hint(self);
+}
+
+template <class Self>
+template <class S, class>
+auto Rev<Self>::len() const -> size_t {
+    return self.len();
+}
+
+template <class Self>
+auto Rev<Self>::advance_by(const size_t n) -> Result<unit_t, size_t> {
+    return details::advance_back_by(self, n);
+}
+
+template <class Self>
+auto Rev<Self>::advance_back_by(const size_t n) -> Result<unit_t, size_t> {
+    return details::advance_by(self, n);
+}
+
+template <class Self>
+auto RevOp::operator()(Self &&self) && -> Rev<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "rev can only take rvalue ref object with Iterator traits");
+
+    return Rev<Self>(std::move(self));
+}
+
+inline auto rev() -> RevOp {
+    return RevOp();
+}
+} // namespace rustfp
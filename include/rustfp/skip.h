@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
+#include "unit.h"
 #include "util.h"
 
 #include <cstddef>
@@ -50,13 +53,80 @@ public:
      * @param count Number of items to skip
      */
     template <class Selfx>
-    Skip(Selfx &&self, const size_t count);
+    RUSTFP_CONSTEXPR Skip(Selfx &&self, const size_t count);
 
     /**
      * Generates the next value of skip operation.
      * @return Some(Item) if there is a next value to generate, otherwise None.
      */
-    auto next() -> Option<Item>;
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, less the items still to
+     * be skipped.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, less the items still to be
+     * skipped. Only available if the underlying iterator is exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Forwards to the fold of the underlying iterator after skipping.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Forwards to the try_fold of the underlying iterator after skipping.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Advances the underlying iterator by n items after skipping, without
+     * generating them.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    RUSTFP_CONSTEXPR auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Generates the next value of skip operation from the back.
+     * Only available if the underlying iterator is double-ended and exact size,
+     * since the items to skip are at the front.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<
+            details::is_double_ended<S>::value
+            && details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
 
 private:
     Self self;
@@ -65,10 +135,10 @@ private:
 
 class SkipOp {
 public:
-    explicit SkipOp(const size_t count);
+    RUSTFP_CONSTEXPR explicit SkipOp(const size_t count);
 
     template <class Self>
-    auto operator()(Self &&self) && -> Skip<Self>;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> Skip<Self>;
 
 private:
     size_t count;
@@ -77,31 +147,106 @@ private:
 /**
  * fn skip(self, n: usize) -> Skip<Self>
  */
-auto skip(const size_t count) -> SkipOp;
+RUSTFP_CONSTEXPR auto skip(const size_t count) -> SkipOp;
 
 // implementation section
 
 template <class Self>
 template <class Selfx>
-Skip<Self>::Skip(Selfx &&self, const size_t count)
+RUSTFP_CONSTEXPR Skip<Self>::Skip(Selfx &&self, const size_t count)
     : self(std::forward<Selfx>(self)), count(count) {
 }
 
 template <class Self>
-auto Skip<Self>::next() -> Option<Item> {
-    while (count > 0) {
-        self.next();
-        --count;
+RUSTFP_CONSTEXPR auto Skip<Self>::next() -> Option<Item> {
+    if (count > 0) {
+        const auto n = count;
+        count = 0;
+        return details::nth(self, n);
     }
 
     return self.next();
 }
 
-inline SkipOp::SkipOp(const size_t count) : count(count) {
+template <class Self>
+RUSTFP_CONSTEXPR auto Skip<Self>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    return size_hint_t(
+        details::saturating_sub(hint.first, count),
+        hint.second.is_some()
+            ? Some(details::saturating_sub(hint.second.get_unchecked(), count))
+            : None);
+}
+
+template <class Self>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Skip<Self>::len() const -> size_t {
+    return details::saturating_sub(self.len(), count);
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Skip<Self>::fold(Acc init, G &&g) -> Acc {
+    if (count > 0) {
+        const auto n = count;
+        count = 0;
+
+        if (details::advance_by(self, n).is_err()) {
+            return init;
+        }
+    }
+
+    return details::fold(self, std::move(init), std::forward<G>(g));
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Skip<Self>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    if (count > 0) {
+        const auto n = count;
+        count = 0;
+
+        if (details::advance_by(self, n).is_err()) {
+            return Ok(std::move(init));
+        }
+    }
+
+    return details::try_fold(self, std::move(init), std::forward<G>(g));
+}
+
+template <class Self>
+RUSTFP_CONSTEXPR auto Skip<Self>::advance_by(const size_t n)
+    -> Result<unit_t, size_t> {
+
+    if (count > 0) {
+        const auto skip_count = count;
+        count = 0;
+
+        // the underlying iterator reports Err(n) below if it runs out here
+        details::advance_by(self, skip_count);
+    }
+
+    return details::advance_by(self, n);
+}
+
+template <class Self>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Skip<Self>::next_back() -> Option<Item> {
+    if (len() > 0) {
+        return self.next_back();
+    }
+
+    return None;
+}
+
+inline RUSTFP_CONSTEXPR SkipOp::SkipOp(const size_t count) : count(count) {
 }
 
 template <class Self>
-auto SkipOp::operator()(Self &&self) && -> Skip<Self> {
+RUSTFP_CONSTEXPR auto SkipOp::operator()(Self &&self) && -> Skip<Self> {
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "skip can only take rvalue ref object with Self traits");
@@ -109,7 +254,7 @@ auto SkipOp::operator()(Self &&self) && -> Skip<Self> {
     return Skip<Self>(std::move(self), count);
 }
 
-inline auto skip(const size_t count) -> SkipOp {
+inline RUSTFP_CONSTEXPR auto skip(const size_t count) -> SkipOp {
     return SkipOp(count);
 }
 } // namespace rustfp
@@ -0,0 +1,128 @@
+/**
+ * Contains the non-owning view over a contiguous range of values, similar to
+ * Rust slice and C++20 std::span.
+ *
+ * slice primitive type: https://doc.rust-lang.org/std/primitive.slice.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iter.h"
+#include "specs.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * Non-owning view over len values starting from ptr, which does not outlive
+ * the values that it refers to. Can be passed into iter and iter_mut like any
+ * other contiguous container.
+ * @tparam T Value type of the range, which is const for immutable views.
+ */
+template <class T>
+class Slice {
+public:
+    /**
+     * Value type of the range without the const specifier.
+     */
+    using value_type = std::remove_const_t<T>;
+
+    /**
+     * Iterator type of the range, which is the pointer to the values.
+     */
+    using iterator = T *;
+
+    /**
+     * Takes in the pointer to the first value and the number of values.
+     * @param ptr Pointer to the first value of the range
+     * @param len Number of values in the range
+     */
+    RUSTFP_CONSTEXPR Slice(T *ptr, const size_t len) RUSTFP_NOEXCEPT;
+
+    /**
+     * Returns the pointer to the first value of the range.
+     * @return Pointer to the first value.
+     */
+    RUSTFP_CONSTEXPR auto data() const RUSTFP_NOEXCEPT -> T *;
+
+    /**
+     * Returns the number of values in the range.
+     * @return Number of values.
+     */
+    RUSTFP_CONSTEXPR auto size() const RUSTFP_NOEXCEPT -> size_t;
+
+    /**
+     * Checks if there are no values in the range.
+     * @return true if the range is empty, otherwise false.
+     */
+    RUSTFP_CONSTEXPR auto empty() const RUSTFP_NOEXCEPT -> bool;
+
+    RUSTFP_CONSTEXPR auto begin() const RUSTFP_NOEXCEPT -> iterator;
+    RUSTFP_CONSTEXPR auto end() const RUSTFP_NOEXCEPT -> iterator;
+
+    /**
+     * Returns the reference to the value at index i without checking the
+     * bounds.
+     * @param i Index of the value, which must be less than size()
+     * @return Reference to the value at the index.
+     */
+    RUSTFP_CONSTEXPR auto operator[](const size_t i) const RUSTFP_NOEXCEPT
+        -> T &;
+
+private:
+    T *ptr;
+    size_t len;
+};
+
+// implementation section
+
+namespace details {
+template <class T>
+struct is_contiguous_iterable<Slice<T>> : std::true_type {};
+} // namespace details
+
+template <class T>
+RUSTFP_CONSTEXPR Slice<T>::Slice(T *ptr, const size_t len) RUSTFP_NOEXCEPT
+    : ptr(ptr),
+      len(len) {
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::data() const RUSTFP_NOEXCEPT -> T * {
+    return ptr;
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::size() const RUSTFP_NOEXCEPT -> size_t {
+    return len;
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::empty() const RUSTFP_NOEXCEPT -> bool {
+    return len == 0;
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::begin() const RUSTFP_NOEXCEPT -> iterator {
+    return ptr;
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::end() const RUSTFP_NOEXCEPT -> iterator {
+    return ptr + len;
+}
+
+template <class T>
+RUSTFP_CONSTEXPR auto Slice<T>::operator[](const size_t i) const
+    RUSTFP_NOEXCEPT -> T & {
+
+    return ptr[i];
+}
+} // namespace rustfp
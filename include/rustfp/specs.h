@@ -1,6 +1,8 @@
 /**
  * Contains noexcept macro to relax the noexcept specifications on MSVC so that
- * it no longer triggers the internal compilation error.
+ * it no longer triggers the internal compilation error, the constexpr macros
+ * for the parts that are only usable in constant expressions on newer
+ * standards, and the branch hints for the rarely taken error paths.
  * @author Chen Weiguang
  * @version 0.1.0
  */
@@ -25,4 +27,36 @@
 #define RUSTFP_NOEXCEPT noexcept
 #define RUSTFP_CONSTEXPR constexpr
 #endif
-#endif
\ No newline at end of file
+#endif
+
+#ifndef RUSTFP_CONSTEXPR_CXX20
+// constructing and destroying union members in place, as done by Result for
+// items that are not trivially copyable, is only allowed in constant
+// expressions from C++20 onwards
+#ifdef __cpp_constexpr_dynamic_alloc
+#define RUSTFP_CONSTEXPR_CXX20 constexpr
+#else
+#define RUSTFP_CONSTEXPR_CXX20
+#endif
+#endif
+
+#ifndef RUSTFP_UNLIKELY
+// Err is expected to be rare, so the Err branches are hinted as unlikely and
+// the error construction is marked as cold, away from the Ok path. cold alone
+// is used since noinline conflicts with the implicit inline of constexpr.
+// define RUSTFP_NO_BRANCH_HINTS to lay out both paths as the compiler sees fit
+#if defined(RUSTFP_NO_BRANCH_HINTS)
+#define RUSTFP_LIKELY(expr) (expr)
+#define RUSTFP_UNLIKELY(expr) (expr)
+#define RUSTFP_COLD
+#elif defined(__GNUC__) || defined(__clang__)
+#define RUSTFP_LIKELY(expr) __builtin_expect(!!(expr), 1)
+#define RUSTFP_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
+#define RUSTFP_COLD __attribute__((cold))
+#else
+// MSVC has no branch weights before C++20 [[likely]], nor a cold attribute
+#define RUSTFP_LIKELY(expr) (expr)
+#define RUSTFP_UNLIKELY(expr) (expr)
+#define RUSTFP_COLD
+#endif
+#endif
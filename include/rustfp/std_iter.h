@@ -0,0 +1,180 @@
+/**
+ * Contains the adaptor from rustfp iterator into std input iterator, so that
+ * rustfp iterators can be consumed by range-for loops and std algorithms
+ * without collecting into a temporary container first.
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * Represents std input iterator that generates the items of the referenced
+ * rustfp iterator. The end iterator is default constructed, and any iterator
+ * whose rustfp iterator has run out of items compares equal to it.
+ * @tparam Iterator rustfp iterator type to generate the items from.
+ */
+template <class Iterator>
+class StdIter {
+public:
+    /**
+     * Item type of the rustfp iterator.
+     */
+    using Item = typename Iterator::Item;
+
+    // std iterator traits
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::decay_t<Item>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::remove_reference_t<Item> &;
+    using pointer = std::remove_reference_t<Item> *;
+
+    /**
+     * Constructs the end iterator.
+     */
+    StdIter();
+
+    /**
+     * Takes in the rustfp iterator to generate the items from, and generates
+     * the first item immediately.
+     * @param it rustfp iterator, which must outlive this iterator.
+     */
+    explicit StdIter(Iterator &it);
+
+    /**
+     * Returns the reference to the current item, which may be moved out.
+     * Only valid if this iterator is not equal to the end iterator.
+     * @return Reference to the current item.
+     */
+    auto operator*() const -> reference;
+
+    /**
+     * Returns the pointer to the current item.
+     * Only valid if this iterator is not equal to the end iterator.
+     * @return Pointer to the current item.
+     */
+    auto operator->() const -> pointer;
+
+    /**
+     * Generates the next item from the rustfp iterator.
+     * @return Reference to this iterator.
+     */
+    auto operator++() -> StdIter &;
+
+    /**
+     * Generates the next item from the rustfp iterator.
+     * @return Copy of this iterator before generating the next item.
+     */
+    auto operator++(int) -> StdIter;
+
+    /**
+     * Checks if both iterators have either run out of items or not.
+     * @param rhs Other iterator to compare with
+     * @return true if both have run out or both have not, otherwise false.
+     */
+    auto operator==(const StdIter &rhs) const -> bool;
+
+    /**
+     * Checks if only one of the iterators has run out of items.
+     * @param rhs Other iterator to compare with
+     * @return true if only one of them has run out, otherwise false.
+     */
+    auto operator!=(const StdIter &rhs) const -> bool;
+
+private:
+    Iterator *it_ptr;
+    mutable Option<Item> curr;
+};
+
+/**
+ * Wraps the rustfp iterator into std input iterator that generates its
+ * items, which is found by ADL in range-for loops. Generates the first item
+ * immediately.
+ * @tparam Iterator rustfp iterator type
+ * @param it rustfp iterator, which must outlive the returned iterator.
+ * @return Begin std input iterator.
+ */
+template <
+    class Iterator,
+    class = std::enable_if_t<details::is_iterator<Iterator>::value>>
+auto begin(Iterator &it) -> StdIter<Iterator>;
+
+/**
+ * Returns the end std input iterator to compare against the iterator
+ * returned by begin.
+ * @tparam Iterator rustfp iterator type
+ * @return End std input iterator.
+ */
+template <
+    class Iterator,
+    class = std::enable_if_t<details::is_iterator<Iterator>::value>>
+auto end(Iterator &) -> StdIter<Iterator>;
+
+// implementation section
+
+template <class Iterator>
+StdIter<Iterator>::StdIter() : it_ptr(nullptr), curr(None) {
+}
+
+template <class Iterator>
+StdIter<Iterator>::StdIter(Iterator &it)
+    : it_ptr(std::addressof(it)), curr(it.next()) {
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator*() const -> reference {
+    return curr.get_mut_unchecked();
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator->() const -> pointer {
+    return std::addressof(curr.get_mut_unchecked());
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator++() -> StdIter & {
+    curr = it_ptr->next();
+    return *this;
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator++(int) -> StdIter {
+    auto prev = *this;
+    ++*this;
+    return prev;
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator==(const StdIter &rhs) const -> bool {
+    return curr.is_none() == rhs.curr.is_none();
+}
+
+template <class Iterator>
+auto StdIter<Iterator>::operator!=(const StdIter &rhs) const -> bool {
+    return !(*this == rhs);
+}
+
+template <class Iterator, class>
+auto begin(Iterator &it) -> StdIter<Iterator> {
+    return StdIter<Iterator>(it);
+}
+
+template <class Iterator, class>
+auto end(Iterator &) -> StdIter<Iterator> {
+    return StdIter<Iterator>();
+}
+} // namespace rustfp
@@ -0,0 +1,237 @@
+/**
+ * Contains Rust Iterator step_by equivalent implementation.
+ *
+ * step_by function:
+ * https://doc.rust-lang.org/std/iter/trait.Iterator.html#method.step_by
+ *
+ * StepBy struct: https://doc.rust-lang.org/std/iter/struct.StepBy.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "util.h"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<I> Iterator for StepBy<I>
+ * where
+ *     I: Iterator,
+ * type Item = <I as Iterator>::Item
+ */
+template <class Self>
+class StepBy {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = typename Self::Item;
+
+    /**
+     * Takes in the moved rustfp Iter instance and the step.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     * @param step Number of items to step over for each item generated,
+     * which must not be 0
+     */
+    template <class Selfx>
+    RUSTFP_CONSTEXPR StepBy(Selfx &&self, const size_t step);
+
+    /**
+     * Generates the first item, then every step-th item after it. The items
+     * in between are skipped with advance_by, which takes O(1) if the
+     * underlying iterator supports it.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left that are generated.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left that are generated. Only
+     * available if the underlying iterator is exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Reads the items by offset if the underlying iterator is trusted random
+     * access, so the loop only computes the offset of each item.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+private:
+    RUSTFP_CONSTEXPR auto stepped_len(const size_t len) const -> size_t;
+
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold_impl(Acc init, G &g, std::true_type) -> Acc;
+
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold_impl(Acc init, G &g, std::false_type) -> Acc;
+
+    Self self;
+    size_t step_minus_one;
+    bool first_take;
+};
+
+class StepByOp {
+public:
+    RUSTFP_CONSTEXPR explicit StepByOp(const size_t step);
+
+    template <class Self>
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> StepBy<Self>;
+
+private:
+    size_t step;
+};
+
+/**
+ * fn step_by(self, step: usize) -> StepBy<Self>
+ */
+RUSTFP_CONSTEXPR auto step_by(const size_t step) -> StepByOp;
+
+// implementation section
+
+template <class Self>
+template <class Selfx>
+RUSTFP_CONSTEXPR StepBy<Self>::StepBy(Selfx &&self, const size_t step)
+    : self(std::forward<Selfx>(self)), step_minus_one(step - 1),
+      first_take(true) {
+
+    assert(step > 0);
+}
+
+template <class Self>
+RUSTFP_CONSTEXPR auto StepBy<Self>::next() -> Option<Item> {
+    if (first_take) {
+        first_take = false;
+        return self.next();
+    }
+
+    return details::nth(self, step_minus_one);
+}
+
+template <class Self>
+RUSTFP_CONSTEXPR auto StepBy<Self>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    return size_hint_t(
+        stepped_len(hint.first),
+        hint.second.is_some()
+            ? Some(stepped_len(hint.second.get_unchecked()))
+            : None);
+}
+
+template <class Self>
+template <class S, class>
+RUSTFP_CONSTEXPR auto StepBy<Self>::len() const -> size_t {
+    return stepped_len(self.len());
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto StepBy<Self>::fold(Acc init, G &&g) -> Acc {
+    return fold_impl(
+        std::move(init), g, details::is_trusted_random_access<Self>());
+}
+
+template <class Self>
+RUSTFP_CONSTEXPR auto StepBy<Self>::stepped_len(const size_t len) const
+    -> size_t {
+
+    const auto step = step_minus_one + 1;
+
+    if (first_take) {
+        return len == 0 ? 0 : 1 + (len - 1) / step;
+    }
+
+    return len / step;
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto StepBy<Self>::fold_impl(Acc init, G &g, std::true_type)
+    -> Acc {
+
+    const auto step = step_minus_one + 1;
+    const auto offset = first_take ? 0 : step_minus_one;
+    const auto count = stepped_len(self.len());
+
+    auto acc = std::move(init);
+
+    for (size_t i = 0; i < count; ++i) {
+        acc = g(std::move(acc), self.at_unchecked(offset + i * step));
+    }
+
+    details::advance_by(self, self.len());
+    first_take = false;
+    return acc;
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto StepBy<Self>::fold_impl(Acc init, G &g, std::false_type)
+    -> Acc {
+
+    auto acc = std::move(init);
+
+    while (true) {
+        auto item_opt = next();
+
+        if (item_opt.is_none()) {
+            return acc;
+        }
+
+        acc = g(std::move(acc), std::move(item_opt).unwrap_unchecked());
+    }
+}
+
+inline RUSTFP_CONSTEXPR StepByOp::StepByOp(const size_t step) : step(step) {
+}
+
+template <class Self>
+RUSTFP_CONSTEXPR auto StepByOp::operator()(Self &&self) && -> StepBy<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "step_by can only take rvalue ref object with Iterator traits");
+
+    return StepBy<Self>(std::move(self), step);
+}
+
+inline RUSTFP_CONSTEXPR auto step_by(const size_t step) -> StepByOp {
+    return StepByOp(step);
+}
+} // namespace rustfp
@@ -12,9 +12,12 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "util.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -50,14 +53,73 @@ public:
      * @param count Number of items to take
      */
     template <class Selfx>
-    Take(Selfx &&self, const size_t count);
+    RUSTFP_CONSTEXPR Take(Selfx &&self, const size_t count);
 
     /**
      * Generates the next value of take operation.
      * @return Some(Item) if there is a next value to generate,
      * otherwise None.
      */
-    auto next() -> Option<Item>;
+    RUSTFP_CONSTEXPR auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of items left, capped at the number of
+     * items to take.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    RUSTFP_CONSTEXPR auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, capped at the number of items to
+     * take. Only available if the underlying iterator is exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto len() const -> size_t;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Stops at the number of items to take.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Stops at the number of items to take.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    RUSTFP_CONSTEXPR auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Generates the next value of take operation from the back.
+     * Only available if the underlying iterator is double-ended and exact size,
+     * since the items beyond the number of items to take have to be skipped
+     * from the back.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<
+            details::is_double_ended<S>::value
+            && details::is_exact_size<S>::value>>
+    RUSTFP_CONSTEXPR auto next_back() -> Option<Item>;
 
 private:
     Self self;
@@ -66,10 +128,10 @@ private:
 
 class TakeOp {
 public:
-    explicit TakeOp(const size_t count);
+    RUSTFP_CONSTEXPR explicit TakeOp(const size_t count);
 
     template <class Self>
-    auto operator()(Self &&self) && -> Take<Self>;
+    RUSTFP_CONSTEXPR auto operator()(Self &&self) && -> Take<Self>;
 
 private:
     size_t count;
@@ -78,18 +140,18 @@ private:
 /**
  * fn take(self, n: usize) -> Take<Self>
  */
-auto take(const size_t count) -> TakeOp;
+RUSTFP_CONSTEXPR auto take(const size_t count) -> TakeOp;
 
 // implementation section
 
 template <class Self>
 template <class Selfx>
-Take<Self>::Take(Selfx &&self, const size_t count)
+RUSTFP_CONSTEXPR Take<Self>::Take(Selfx &&self, const size_t count)
     : self(std::forward<Selfx>(self)), count(count) {
 }
 
 template <class Self>
-auto Take<Self>::next() -> Option<Item> {
+RUSTFP_CONSTEXPR auto Take<Self>::next() -> Option<Item> {
     if (count > 0) {
         --count;
         return self.next();
@@ -98,11 +160,97 @@ auto Take<Self>::next() -> Option<Item> {
     return None;
 }
 
-TakeOp::TakeOp(const size_t count) : count(count) {
+template <class Self>
+RUSTFP_CONSTEXPR auto Take<Self>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    return size_hint_t(
+        std::min(hint.first, count),
+        details::min_upper(hint.second, Some(count)));
+}
+
+template <class Self>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Take<Self>::len() const -> size_t {
+    return std::min(self.len(), count);
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Take<Self>::fold(Acc init, G &&g) -> Acc {
+    if (count == 0) {
+        return init;
+    }
+
+    // Err is used to break out of the fold once count reaches 0
+    return details::unwrap_either(details::try_fold(
+        self,
+        std::move(init),
+        [this, &g](Acc acc, Item item) -> Result<Acc, Acc> {
+            auto next_acc = g(std::move(acc), std::forward<Item>(item));
+            --count;
+
+            if (count == 0) {
+                return Err(std::move(next_acc));
+            }
+
+            return Ok(std::move(next_acc));
+        }));
+}
+
+template <class Self>
+template <class Acc, class G>
+RUSTFP_CONSTEXPR auto Take<Self>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    using R = try_fold_t<Acc, G, Item>;
+
+    if (count == 0) {
+        return Ok(std::move(init));
+    }
+
+    // Err(Ok(acc)) is used to break out of the fold once count reaches 0
+    return details::unwrap_break(details::try_fold(
+        self,
+        std::move(init),
+        [this, &g](Acc acc, Item item) -> Result<Acc, R> {
+            R res = g(std::move(acc), std::forward<Item>(item));
+            --count;
+
+            if (res.is_err()) {
+                return Err(std::move(res));
+            }
+
+            if (count == 0) {
+                return Err(R(Ok(std::move(res).unwrap_unchecked())));
+            }
+
+            return Ok(std::move(res).unwrap_unchecked());
+        }));
+}
+
+template <class Self>
+template <class S, class>
+RUSTFP_CONSTEXPR auto Take<Self>::next_back() -> Option<Item> {
+    if (count == 0) {
+        return None;
+    }
+
+    const auto len = self.len();
+
+    if (len > count) {
+        details::advance_back_by(self, len - count);
+    }
+
+    --count;
+    return self.next_back();
+}
+
+inline RUSTFP_CONSTEXPR TakeOp::TakeOp(const size_t count) : count(count) {
 }
 
 template <class Self>
-auto TakeOp::operator()(Self &&self) && -> Take<Self> {
+RUSTFP_CONSTEXPR auto TakeOp::operator()(Self &&self) && -> Take<Self> {
     static_assert(
         !std::is_lvalue_reference<Self>::value,
         "take can only take rvalue ref object with Self traits");
@@ -110,7 +258,7 @@ auto TakeOp::operator()(Self &&self) && -> Take<Self> {
     return Take<Self>(std::move(self), count);
 }
 
-inline auto take(const size_t count) -> TakeOp {
+inline RUSTFP_CONSTEXPR auto take(const size_t count) -> TakeOp {
     return TakeOp(count);
 }
 } // namespace rustfp
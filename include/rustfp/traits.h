@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "specs.h"
+
 #include <functional>
 #include <type_traits>
 
@@ -63,6 +65,11 @@ template <class T>
 struct simplify_ref_impl<const std::reference_wrapper<T> &> {
     using type = T &;
 };
+
+template <class...>
+struct void_impl {
+    using type = void;
+};
 } // namespace details
 
 template <class T>
@@ -77,21 +84,27 @@ using simplify_ref_t = typename details::simplify_ref_impl<T>::type;
 template <class T>
 using special_move_t = T &&;
 
+/**
+ * C++14 substitute of std::void_t, used for detecting well-formed expressions.
+ */
+template <class... Ts>
+using void_t = typename details::void_impl<Ts...>::type;
+
 template <class T>
-auto special_decay(T &&val) -> special_decay_t<T>;
+RUSTFP_CONSTEXPR auto special_decay(T &&val) -> special_decay_t<T>;
 
 template <class T>
-auto reverse_decay(T &&val) -> reverse_decay_t<T>;
+RUSTFP_CONSTEXPR auto reverse_decay(T &&val) -> reverse_decay_t<T>;
 
 // implementation section
 
 template <class T>
-inline auto special_decay(T &&val) -> special_decay_t<T> {
+inline RUSTFP_CONSTEXPR auto special_decay(T &&val) -> special_decay_t<T> {
     return special_decay_t<T>(std::forward<T>(val));
 }
 
 template <class T>
-inline auto reverse_decay(T &&val) -> reverse_decay_t<T> {
+inline RUSTFP_CONSTEXPR auto reverse_decay(T &&val) -> reverse_decay_t<T> {
     return reverse_decay_t<T>(std::forward<T>(val));
 }
 } // namespace rustfp
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "specs.h"
+
 #include <type_traits>
 #include <utility>
 
@@ -17,12 +19,15 @@ template <
     class Op,
     class = typename Iterator::Item,
     class = decltype(std::declval<Op>()(std::move(std::declval<Iterator>())))>
-auto operator|(Iterator &&it, Op &&op) -> std::result_of_t<Op(Iterator)>;
+RUSTFP_CONSTEXPR auto operator|(Iterator &&it, Op &&op)
+    -> std::result_of_t<Op(Iterator)>;
 
 // implementation section
 
 template <class Iterator, class Op, class, class>
-auto operator|(Iterator &&it, Op &&op) -> std::result_of_t<Op(Iterator)> {
+RUSTFP_CONSTEXPR auto operator|(Iterator &&it, Op &&op)
+    -> std::result_of_t<Op(Iterator)> {
+
     static_assert(
         !std::is_lvalue_reference<Iterator>::value
             && !std::is_lvalue_reference<Iterator>::value,
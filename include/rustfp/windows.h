@@ -0,0 +1,337 @@
+/**
+ * Contains Rust slice windows equivalent implementation.
+ *
+ * windows function:
+ * https://doc.rust-lang.org/std/primitive.slice.html#method.windows
+ *
+ * Windows struct: https://doc.rust-lang.org/std/slice/struct.Windows.html
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "iterator.h"
+#include "option.h"
+#include "slice.h"
+#include "util.h"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rustfp {
+
+// declaration section
+
+/**
+ * impl<'a, T> Iterator for Windows<'a, T>
+ * type Item = &'a [T]
+ *
+ * Generates Slice views of every size consecutive values of a contiguous
+ * iterator such as ContiguousIter, moving forward by one value per step. No
+ * values are copied.
+ */
+template <class Self, bool = details::is_contiguous<Self>::value>
+class Windows {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = Slice<std::remove_reference_t<typename Self::Item>>;
+
+    /**
+     * Takes in the moved rustfp Iter instance and the window size.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     * @param size Number of values in each window, which must not be 0
+     */
+    template <class Selfx>
+    Windows(Selfx &&self, const size_t size);
+
+    /**
+     * Generates the next window of values in O(1).
+     * @return Some(Item) if there are at least size values left, otherwise
+     * None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of windows left, which is always
+     * exact.
+     * @return (lower bound, upper bound) of the number of windows left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of windows left.
+     * @return Number of windows left.
+     */
+    auto len() const -> size_t;
+
+    /**
+     * Returns the window at offset i from the front without advancing the
+     * iterator or checking the bounds.
+     * @param i Offset of the window, which must be less than len()
+     * @return Window at the offset.
+     */
+    auto at_unchecked(const size_t i) const -> Item;
+
+    /**
+     * Folds every window left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Reads every window by offset from the same pointer, so the loop neither
+     * checks the length nor advances the underlying iterator per window.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each window
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+private:
+    Self self;
+    size_t size;
+};
+
+/**
+ * Generates Slice views of every size consecutive items of any other
+ * iterator. The items are copied into a ring buffer of twice the window size,
+ * where each item is stored at both i and i + size, so that every window is
+ * contiguous and each step only writes the new item twice.
+ * Each Slice is only valid until the next call to next.
+ */
+template <class Self>
+class Windows<Self, false> {
+public:
+    /**
+     * Type alias to rustfp Iter type.
+     */
+    using I = Self;
+
+    /**
+     * Type of the values stored in the ring buffer.
+     */
+    using Value = std::decay_t<typename Self::Item>;
+
+    /**
+     * Item type to generate.
+     */
+    using Item = Slice<const Value>;
+
+    /**
+     * Takes in the moved rustfp Iter instance and the window size.
+     * @tparam Selfx Forwarded type of Self, rustfp Iter type
+     * @param self rustfp Iter instance
+     * @param size Number of items in each window, which must not be 0
+     */
+    template <class Selfx>
+    Windows(Selfx &&self, const size_t size);
+
+    /**
+     * Generates the next window of items. Only the first window takes size
+     * items from the underlying iterator, every other window takes one.
+     * @return Some(Item) if there are enough items left, otherwise None.
+     */
+    auto next() -> Option<Item>;
+
+    /**
+     * Returns the bounds on the number of windows left.
+     * @return (lower bound, upper bound) of the number of windows left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of windows left. Only available if the
+     * underlying iterator is exact size.
+     * @return Number of windows left.
+     */
+    template <
+        class S = Self,
+        class = std::enable_if_t<details::is_exact_size<S>::value>>
+    auto len() const -> size_t;
+
+private:
+    auto is_filled() const -> bool;
+
+    Self self;
+    size_t size;
+    size_t start;
+    std::vector<Value> buffer;
+};
+
+class WindowsOp {
+public:
+    explicit WindowsOp(const size_t size);
+
+    template <class Self>
+    auto operator()(Self &&self) && -> Windows<Self>;
+
+private:
+    size_t size;
+};
+
+/**
+ * fn windows(&self, size: usize) -> Windows<T>
+ */
+auto windows(const size_t size) -> WindowsOp;
+
+// implementation section
+
+namespace details {
+// number of windows of the given size over len values
+inline RUSTFP_CONSTEXPR auto windows_len(const size_t len, const size_t size)
+    -> size_t {
+
+    return len >= size ? len - size + 1 : 0;
+}
+} // namespace details
+
+template <class Self, bool Contiguous>
+template <class Selfx>
+Windows<Self, Contiguous>::Windows(Selfx &&self, const size_t size)
+    : self(std::forward<Selfx>(self)), size(size) {
+
+    assert(size > 0);
+}
+
+template <class Self, bool Contiguous>
+auto Windows<Self, Contiguous>::next() -> Option<Item> {
+    if (self.len() < size) {
+        return None;
+    }
+
+    const auto ptr = self.as_ptr();
+    details::advance_by(self, 1);
+    return Some(Item(ptr, size));
+}
+
+template <class Self, bool Contiguous>
+auto Windows<Self, Contiguous>::size_hint() const -> size_hint_t {
+    return details::exact_size_hint(len());
+}
+
+template <class Self, bool Contiguous>
+auto Windows<Self, Contiguous>::len() const -> size_t {
+    return details::windows_len(self.len(), size);
+}
+
+template <class Self, bool Contiguous>
+auto Windows<Self, Contiguous>::at_unchecked(const size_t i) const -> Item {
+    return Item(self.as_ptr() + i, size);
+}
+
+template <class Self, bool Contiguous>
+template <class Acc, class G>
+auto Windows<Self, Contiguous>::fold(Acc init, G &&g) -> Acc {
+    const auto count = len();
+    auto acc = std::move(init);
+
+    for (size_t i = 0; i < count; ++i) {
+        acc = g(std::move(acc), at_unchecked(i));
+    }
+
+    details::advance_by(self, count);
+    return acc;
+}
+
+template <class Self>
+template <class Selfx>
+Windows<Self, false>::Windows(Selfx &&self, const size_t size)
+    : self(std::forward<Selfx>(self)), size(size), start(0) {
+
+    assert(size > 0);
+    buffer.reserve(size * 2);
+}
+
+template <class Self>
+auto Windows<Self, false>::next() -> Option<Item> {
+    if (!is_filled()) {
+        while (buffer.size() < size) {
+            auto item_opt = self.next();
+
+            if (item_opt.is_none()) {
+                return None;
+            }
+
+            buffer.push_back(std::move(item_opt).unwrap_unchecked());
+        }
+
+        // no reallocation takes place since the capacity is reserved
+        for (size_t i = 0; i < size; ++i) {
+            buffer.push_back(buffer[i]);
+        }
+
+        return Some(Item(buffer.data(), size));
+    }
+
+    auto item_opt = self.next();
+
+    if (item_opt.is_none()) {
+        return None;
+    }
+
+    // overwrites the oldest item at both of its positions
+    buffer[start + size] = std::move(item_opt).unwrap_unchecked();
+    buffer[start] = buffer[start + size];
+    start = start + 1 < size ? start + 1 : 0;
+
+    return Some(Item(buffer.data() + start, size));
+}
+
+template <class Self>
+auto Windows<Self, false>::size_hint() const -> size_hint_t {
+    const auto hint = details::size_hint(self);
+
+    if (is_filled()) {
+        return hint;
+    }
+
+    const auto buffered = buffer.size();
+
+    return size_hint_t(
+        details::windows_len(hint.first + buffered, size),
+        hint.second.is_some()
+            ? Some(details::windows_len(
+                  hint.second.get_unchecked() + buffered, size))
+            : None);
+}
+
+template <class Self>
+template <class S, class>
+auto Windows<Self, false>::len() const -> size_t {
+    return is_filled() ? self.len()
+                       : details::windows_len(self.len() + buffer.size(), size);
+}
+
+template <class Self>
+auto Windows<Self, false>::is_filled() const -> bool {
+    return buffer.size() == size * 2;
+}
+
+inline WindowsOp::WindowsOp(const size_t size) : size(size) {
+}
+
+template <class Self>
+auto WindowsOp::operator()(Self &&self) && -> Windows<Self> {
+    static_assert(
+        !std::is_lvalue_reference<Self>::value,
+        "windows can only take rvalue ref object with Iterator traits");
+
+    return Windows<Self>(std::move(self), size);
+}
+
+inline auto windows(const size_t size) -> WindowsOp {
+    return WindowsOp(size);
+}
+} // namespace rustfp
@@ -13,10 +13,15 @@
 
 #pragma once
 
+#include "iterator.h"
 #include "option.h"
+#include "result.h"
 #include "traits.h"
+#include "unit.h"
 #include "util.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -62,12 +67,129 @@ public:
 
     /**
      * Generates the next value of zip operation.
+     * Other is not advanced once self has run out of items.
      * @return Some(Item) if there is a next value to generate,
      * otherwise None.
      */
     auto next() -> Option<Item>;
 
+    /**
+     * Returns the bounds on the number of items left, which is bounded by the
+     * shorter of both iterators.
+     * @return (lower bound, upper bound) of the number of items left.
+     */
+    auto size_hint() const -> size_hint_t;
+
+    /**
+     * Returns the exact number of items left, which is the length of the
+     * shorter iterator. Only available if both iterators are exact size.
+     * @return Number of items left.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_exact_size<S>::value
+            && details::is_exact_size<O>::value>>
+    auto len() const -> size_t;
+
+    /**
+     * Returns the pair of items at offset i from the front of both iterators
+     * without advancing them or checking the bounds. Only available if both
+     * iterators support at_unchecked.
+     * @param i Offset of the items, which must be less than len()
+     * @return Item at the offset.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_trusted_random_access<S>::value
+            && details::is_trusted_random_access<O>::value>>
+    auto at_unchecked(const size_t i) -> Item;
+
+    /**
+     * Advances both iterators by n items without generating them. Only
+     * available if both iterators support at_unchecked.
+     * @param n Number of items to advance by
+     * @return Ok(Unit) if n items are advanced, otherwise Err(k) where k is
+     * the number of steps that could not be advanced.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_trusted_random_access<S>::value
+            && details::is_trusted_random_access<O>::value>>
+    auto advance_by(const size_t n) -> Result<unit_t, size_t>;
+
+    /**
+     * Folds every item left into an accumulator by applying an operation,
+     * returning the final accumulator.
+     * Stops as soon as either of the iterators runs out of items. If both
+     * iterators support at_unchecked, the shorter length is computed once and
+     * both are indexed in lockstep instead.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Acc
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Final accumulator value
+     */
+    template <class Acc, class G>
+    auto fold(Acc init, G &&g) -> Acc;
+
+    /**
+     * Folds the items left into an accumulator for as long as the operation
+     * returns Ok, stopping at the first Err.
+     * Stops as soon as either of the iterators runs out of items. If both
+     * iterators support at_unchecked, they are indexed in lockstep instead.
+     * @tparam Acc Accumulator type
+     * @tparam G Function type, where G: FnMut(Acc, Item) -> Result<Acc, E>
+     * @param init Initial accumulator value
+     * @param g Function to apply on the accumulator and each item
+     * @return Ok(final accumulator) if every item is folded, otherwise the
+     * first Err returned by g.
+     */
+    template <class Acc, class G>
+    auto try_fold(Acc init, G &&g) -> try_fold_t<Acc, G, Item>;
+
+    /**
+     * Generates the next value of zip operation from the back.
+     * Only available if both iterators are double-ended and exact size, since
+     * the longer side has to be trimmed from the back first.
+     * @return Some(Item) if there is a next value to generate,
+     * otherwise None.
+     */
+    template <
+        class S = Self,
+        class O = Other,
+        class = std::enable_if_t<
+            details::is_double_ended<S>::value
+            && details::is_double_ended<O>::value
+            && details::is_exact_size<S>::value
+            && details::is_exact_size<O>::value>>
+    auto next_back() -> Option<Item>;
+
 private:
+    using is_trusted_random_access = std::integral_constant<
+        bool,
+        details::is_trusted_random_access<Self>::value
+            && details::is_trusted_random_access<Other>::value>;
+
+    template <class Acc, class G>
+    auto fold_impl(Acc init, G &g, std::true_type) -> Acc;
+
+    template <class Acc, class G>
+    auto fold_impl(Acc init, G &g, std::false_type) -> Acc;
+
+    template <class Acc, class G>
+    auto try_fold_impl(Acc init, G &g, std::true_type)
+        -> try_fold_t<Acc, G, Item>;
+
+    template <class Acc, class G>
+    auto try_fold_impl(Acc init, G &g, std::false_type)
+        -> try_fold_t<Acc, G, Item>;
+
     Self self;
     Other other;
 };
@@ -104,8 +226,192 @@ Zip<Self, Other>::Zip(Selfx &&self, Otherx &&other)
 template <class Self, class Other>
 auto Zip<Self, Other>::next() -> Option<Item> {
     auto opt_next = self.next();
+
+    // other must not be advanced if self has run out, otherwise its next item
+    // is lost
+    if (opt_next.is_none()) {
+        return None;
+    }
+
     auto opt_rhs_next = other.next();
 
+    if (opt_rhs_next.is_none()) {
+        return None;
+    }
+
+    return Some(Item(
+        std::move(opt_next).unwrap_unchecked(),
+        std::move(opt_rhs_next).unwrap_unchecked()));
+}
+
+template <class Self, class Other>
+auto Zip<Self, Other>::size_hint() const -> size_hint_t {
+    const auto self_hint = details::size_hint(self);
+    const auto other_hint = details::size_hint(other);
+
+    return size_hint_t(
+        std::min(self_hint.first, other_hint.first),
+        details::min_upper(self_hint.second, other_hint.second));
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Zip<Self, Other>::len() const -> size_t {
+    return std::min(self.len(), other.len());
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Zip<Self, Other>::at_unchecked(const size_t i) -> Item {
+    return Item(self.at_unchecked(i), other.at_unchecked(i));
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Zip<Self, Other>::advance_by(const size_t n) -> Result<unit_t, size_t> {
+    const auto step = std::min(n, len());
+
+    details::advance_by(self, step);
+    details::advance_by(other, step);
+
+    if (step < n) {
+        return Err(n - step);
+    }
+
+    return Ok(Unit);
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::fold(Acc init, G &&g) -> Acc {
+    return fold_impl(std::move(init), g, is_trusted_random_access());
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::try_fold(Acc init, G &&g)
+    -> try_fold_t<Acc, G, Item> {
+
+    return try_fold_impl(std::move(init), g, is_trusted_random_access());
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::fold_impl(Acc init, G &g, std::true_type) -> Acc {
+    // counted loop over both sides so that it can be vectorized
+    const auto count = len();
+    auto acc = std::move(init);
+
+    for (size_t i = 0; i < count; ++i) {
+        acc = g(std::move(acc), at_unchecked(i));
+    }
+
+    details::advance_by(self, count);
+    details::advance_by(other, count);
+    return acc;
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::fold_impl(Acc init, G &g, std::false_type) -> Acc {
+    using SelfItem = typename Self::Item;
+
+    // Err is used to break out of the fold once other runs out of items
+    return details::unwrap_either(details::try_fold(
+        self,
+        std::move(init),
+        [this, &g](Acc acc, SelfItem item) -> Result<Acc, Acc> {
+            auto opt_rhs_next = other.next();
+
+            if (opt_rhs_next.is_none()) {
+                return Err(std::move(acc));
+            }
+
+            return Ok(g(
+                std::move(acc),
+                Item(
+                    std::forward<SelfItem>(item),
+                    std::move(opt_rhs_next).unwrap_unchecked())));
+        }));
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::try_fold_impl(Acc init, G &g, std::true_type)
+    -> try_fold_t<Acc, G, Item> {
+
+    using R = try_fold_t<Acc, G, Item>;
+
+    const auto count = len();
+    auto acc = std::move(init);
+
+    for (size_t i = 0; i < count; ++i) {
+        R res = g(std::move(acc), at_unchecked(i));
+
+        if (res.is_err()) {
+            details::advance_by(self, i + 1);
+            details::advance_by(other, i + 1);
+            return res;
+        }
+
+        acc = std::move(res).unwrap_unchecked();
+    }
+
+    details::advance_by(self, count);
+    details::advance_by(other, count);
+    return Ok(std::move(acc));
+}
+
+template <class Self, class Other>
+template <class Acc, class G>
+auto Zip<Self, Other>::try_fold_impl(Acc init, G &g, std::false_type)
+    -> try_fold_t<Acc, G, Item> {
+
+    using SelfItem = typename Self::Item;
+    using R = try_fold_t<Acc, G, Item>;
+
+    // Err(Ok(acc)) is used to break out of the fold once other runs out of
+    // items
+    return details::unwrap_break(details::try_fold(
+        self,
+        std::move(init),
+        [this, &g](Acc acc, SelfItem item) -> Result<Acc, R> {
+            auto opt_rhs_next = other.next();
+
+            if (opt_rhs_next.is_none()) {
+                return Err(R(Ok(std::move(acc))));
+            }
+
+            R res = g(
+                std::move(acc),
+                Item(
+                    std::forward<SelfItem>(item),
+                    std::move(opt_rhs_next).unwrap_unchecked()));
+
+            if (res.is_err()) {
+                return Err(std::move(res));
+            }
+
+            return Ok(std::move(res).unwrap_unchecked());
+        }));
+}
+
+template <class Self, class Other>
+template <class S, class O, class>
+auto Zip<Self, Other>::next_back() -> Option<Item> {
+    const auto self_len = self.len();
+    const auto other_len = other.len();
+
+    // trims the longer side so that both sides end at the same item
+    if (self_len > other_len) {
+        details::advance_back_by(self, self_len - other_len);
+    } else if (other_len > self_len) {
+        details::advance_back_by(other, other_len - self_len);
+    }
+
+    auto opt_next = self.next_back();
+    auto opt_rhs_next = other.next_back();
+
     if (opt_next.is_some() && opt_rhs_next.is_some()) {
         return Some(Item(
             std::move(opt_next).unwrap_unchecked(),
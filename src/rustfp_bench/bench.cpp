@@ -0,0 +1,960 @@
+#include "bench.h"
+
+#include "rustfp/all.h"
+#include "rustfp/any.h"
+#include "rustfp/chain.h"
+#include "rustfp/chunks.h"
+#include "rustfp/collect.h"
+#include "rustfp/enumerate.h"
+#include "rustfp/filter.h"
+#include "rustfp/find.h"
+#include "rustfp/flat_map.h"
+#include "rustfp/flatten.h"
+#include "rustfp/fold.h"
+#include "rustfp/for_each.h"
+#include "rustfp/iter.h"
+#include "rustfp/lazy_error.h"
+#include "rustfp/let.h"
+#include "rustfp/map.h"
+#include "rustfp/peekable.h"
+#include "rustfp/range.h"
+#include "rustfp/result.h"
+#include "rustfp/rev.h"
+#include "rustfp/skip.h"
+#include "rustfp/slice.h"
+#include "rustfp/step_by.h"
+#include "rustfp/take.h"
+#include "rustfp/windows.h"
+#include "rustfp/zip.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// rustfp
+using rustfp::all;
+using rustfp::any;
+using rustfp::array_chunks;
+using rustfp::chain;
+using rustfp::chunks;
+using rustfp::collect;
+using rustfp::enumerate;
+using rustfp::Err;
+using rustfp::filter;
+using rustfp::find;
+using rustfp::flat_map;
+using rustfp::flatten;
+using rustfp::fold;
+using rustfp::for_each;
+using rustfp::iter;
+using rustfp::LazyError;
+using rustfp::map;
+using rustfp::Ok;
+using rustfp::peekable;
+using rustfp::range;
+using rustfp::Result;
+using rustfp::rev;
+using rustfp::skip;
+using rustfp::Slice;
+using rustfp::step_by;
+using rustfp::take;
+using rustfp::windows;
+using rustfp::zip;
+using rustfp::bench::do_not_optimize;
+using rustfp::bench::run;
+
+// std
+using std::array;
+using std::cref;
+using std::iota;
+using std::max;
+using std::max_element;
+using std::min;
+using std::string;
+using std::to_string;
+using std::vector;
+
+namespace {
+constexpr size_t LEN = 1 << 16;
+constexpr size_t ITERATIONS = 1000;
+
+enum class ParseError { Odd, Overflow };
+
+auto make_input() -> vector<int64_t> {
+    vector<int64_t> v(LEN);
+    iota(v.begin(), v.end(), 0);
+    return v;
+}
+
+void bench_map_filter_fold(const vector<int64_t> &v) {
+    run("map_filter_fold/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (const auto value : v) {
+            const auto doubled = value * 2;
+
+            if (doubled % 3 == 0) {
+                sum += doubled;
+            }
+        }
+
+        return sum;
+    });
+
+    run("map_filter_fold/rustfp", ITERATIONS, [&v] {
+        return iter(v) | map([](const int64_t value) { return value * 2; })
+               | filter([](const int64_t value) { return value % 3 == 0; })
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+}
+
+void bench_range_take_fold() {
+    run("range_take_fold/loop", ITERATIONS, [] {
+        size_t len = LEN;
+        do_not_optimize(len);
+
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < len / 2; ++i) {
+            sum += static_cast<int64_t>(i);
+        }
+
+        return sum;
+    });
+
+    run("range_take_fold/rustfp", ITERATIONS, [] {
+        // Bounds are passed through do_not_optimize so that the whole fold
+        // cannot be constant folded away
+        size_t len = LEN;
+        do_not_optimize(len);
+
+        return range(size_t(0), len) | take(len / 2)
+               | fold(int64_t(0), [](const int64_t acc, const size_t value) {
+                     return acc + static_cast<int64_t>(value);
+                 });
+    });
+}
+
+void bench_for_each(const vector<int64_t> &v) {
+    run("for_each/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (const auto value : v) {
+            sum ^= value;
+        }
+
+        return sum;
+    });
+
+    run("for_each/rustfp", ITERATIONS, [&v] {
+        int64_t sum = 0;
+        iter(v) | for_each([&sum](const int64_t value) { sum ^= value; });
+        return sum;
+    });
+}
+
+void bench_short_circuit(const vector<int64_t> &v) {
+    const int64_t target = LEN - 1;
+
+    run("find/loop", ITERATIONS, [&v, target] {
+        for (const auto value : v) {
+            if (value == target) {
+                return true;
+            }
+        }
+
+        return false;
+    });
+
+    run("find/rustfp", ITERATIONS, [&v, target] {
+        return (iter(v) | find([target](const int64_t value) {
+                    return value == target;
+                }))
+            .is_some();
+    });
+
+    run("all/loop", ITERATIONS, [&v] {
+        for (const auto value : v) {
+            if (value < 0) {
+                return false;
+            }
+        }
+
+        return true;
+    });
+
+    run("all/rustfp", ITERATIONS, [&v] {
+        return iter(v) | all([](const int64_t value) { return value >= 0; });
+    });
+
+    run("any/loop", ITERATIONS, [&v] {
+        for (const auto value : v) {
+            if (value < 0) {
+                return true;
+            }
+        }
+
+        return false;
+    });
+
+    run("any/rustfp", ITERATIONS, [&v] {
+        return iter(v) | any([](const int64_t value) { return value < 0; });
+    });
+}
+
+void bench_skip_take(const vector<int64_t> &v) {
+    const size_t offset = LEN - 16;
+    const size_t limit = 8;
+
+    run("skip_take/loop", ITERATIONS, [&v, offset, limit] {
+        int64_t sum = 0;
+
+        for (size_t i = offset; i < offset + limit; ++i) {
+            sum += v[i];
+        }
+
+        return sum;
+    });
+
+    run("skip_take/rustfp", ITERATIONS, [&v, offset, limit] {
+        return iter(v) | skip(offset) | take(limit)
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+}
+
+void bench_rev_filter_take(const vector<int64_t> &v) {
+    const size_t limit = 64;
+
+    run("rev_filter_take/loop", ITERATIONS, [&v, limit] {
+        vector<int64_t> out;
+
+        for (auto it = v.crbegin(); it != v.crend() && out.size() < limit;
+             ++it) {
+            if (*it % 7 == 0) {
+                out.push_back(*it);
+            }
+        }
+
+        return out.size();
+    });
+
+    run("rev_filter_take/rustfp", ITERATIONS, [&v, limit] {
+        return (iter(v) | rev()
+                | filter([](const int64_t value) { return value % 7 == 0; })
+                | take(limit) | collect<vector<int64_t>>())
+            .size();
+    });
+}
+
+void bench_collect(const vector<int64_t> &v) {
+    run("map_collect/loop", ITERATIONS, [&v] {
+        vector<int64_t> out;
+        out.reserve(v.size());
+
+        for (const auto value : v) {
+            out.push_back(value + 1);
+        }
+
+        return out.size();
+    });
+
+    run("map_collect/rustfp", ITERATIONS, [&v] {
+        return (iter(v) | map([](const int64_t value) { return value + 1; })
+                | collect<vector<int64_t>>())
+            .size();
+    });
+}
+
+void bench_zip_dot(const vector<int64_t> &v) {
+    const auto w = v;
+
+    run("zip_dot/loop", ITERATIONS, [&v, &w] {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < v.size(); ++i) {
+            sum += v[i] * w[i];
+        }
+
+        return sum;
+    });
+
+    run("zip_dot/rustfp", ITERATIONS, [&v, &w] {
+        return iter(v) | zip(iter(w))
+               | map([](const auto &pair) { return pair.first * pair.second; })
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+}
+
+void bench_filter_find(const vector<int64_t> &v) {
+    const int64_t target = LEN - 1;
+
+    run("filter_find/loop", ITERATIONS, [&v, target] {
+        for (const auto &value : v) {
+            if (value % 2 == 1 && value == target) {
+                return &value;
+            }
+        }
+
+        return static_cast<const int64_t *>(nullptr);
+    });
+
+    run("filter_find/rustfp", ITERATIONS, [&v, target] {
+        const auto found =
+            iter(v) | filter([](const int64_t value) { return value % 2 == 1; })
+            | find([target](const int64_t value) { return value == target; });
+
+        return found.is_some() ? &found.get_unchecked() : nullptr;
+    });
+}
+
+void bench_stacked_next(const vector<int64_t> &v) {
+    run("stacked_next/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < v.size(); ++i) {
+            const auto doubled = v[i] * 2;
+
+            if (doubled % 3 != 0) {
+                sum += doubled + static_cast<int64_t>(i);
+            }
+        }
+
+        return sum;
+    });
+
+    // every layer returns its Option<int64_t> by value from next()
+    run("stacked_next/rustfp", ITERATIONS, [&v] {
+        auto it = iter(v) | map([](const int64_t value) { return value * 2; })
+                  | enumerate()
+                  | filter([](const auto &pair) {
+                        return pair.second % 3 != 0;
+                    })
+                  | map([](const auto &pair) {
+                        return pair.second + static_cast<int64_t>(pair.first);
+                    })
+                  | take(LEN);
+
+        int64_t sum = 0;
+
+        while (true) {
+            const auto value = it.next();
+
+            if (value.is_none()) {
+                break;
+            }
+
+            sum += value.get_unchecked();
+        }
+
+        return sum;
+    });
+}
+
+// every other token fails to parse
+auto parse_token(const int64_t token) -> Result<int64_t, ParseError> {
+    if (token % 2 != 0) {
+        return Err(ParseError::Odd);
+    }
+
+    return Ok(token / 2);
+}
+
+auto parse_pair(const int64_t lhs, const int64_t rhs)
+    -> Result<int64_t, ParseError> {
+
+    RUSTFP_LET(lhs_value, parse_token(lhs));
+    RUSTFP_LET(rhs_value, parse_token(rhs));
+
+    if (lhs_value > rhs_value) {
+        return Err(ParseError::Overflow);
+    }
+
+    return Ok(rhs_value - lhs_value);
+}
+
+auto parse_token_raw(const int64_t token, int64_t &value) -> bool {
+    if (token % 2 != 0) {
+        return false;
+    }
+
+    value = token / 2;
+    return true;
+}
+
+void bench_let_parse(const vector<int64_t> &v) {
+    run("let_parse/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+        int64_t err_count = 0;
+
+        for (size_t i = 0; i + 1 < v.size(); ++i) {
+            int64_t lhs_value = 0;
+            int64_t rhs_value = 0;
+
+            if (!parse_token_raw(v[i] + v[i] / 3, lhs_value)
+                || !parse_token_raw(v[i + 1], rhs_value)
+                || lhs_value > rhs_value) {
+
+                ++err_count;
+                continue;
+            }
+
+            sum += rhs_value - lhs_value;
+        }
+
+        return sum + err_count;
+    });
+
+    run("let_parse/rustfp", ITERATIONS, [&v] {
+        int64_t sum = 0;
+        int64_t err_count = 0;
+
+        for (size_t i = 0; i + 1 < v.size(); ++i) {
+            parse_pair(v[i] + v[i] / 3, v[i + 1])
+                .match(
+                    [&sum](const int64_t value) { sum += value; },
+                    [&err_count](const ParseError) { ++err_count; });
+        }
+
+        return sum + err_count;
+    });
+}
+
+// rarely fails, but with an error message that takes much more code to build
+// than the Ok path, which bloats the parsing loop unless it is kept out of line
+auto parse_field(const int64_t token) -> Result<int64_t, string> {
+    if (token % 4096 == 4095) {
+        return Err("field out of range: " + to_string(token));
+    }
+
+    return Ok(token % 1000);
+}
+
+auto parse_record(const int64_t *const fields) -> Result<int64_t, string> {
+    RUSTFP_LET(id, parse_field(fields[0]));
+    RUSTFP_LET(qty, parse_field(fields[1]));
+    RUSTFP_LET(price, parse_field(fields[2]));
+    return Ok(id + qty * price);
+}
+
+auto parse_field_raw(const int64_t token, int64_t &value, string &err)
+    -> bool {
+
+    if (token % 4096 == 4095) {
+        err = "field out of range: " + to_string(token);
+        return false;
+    }
+
+    value = token % 1000;
+    return true;
+}
+
+void bench_cold_err_parse(const vector<int64_t> &v) {
+    constexpr size_t RECORD_LEN = 3;
+    constexpr size_t CHUNK_LEN = 1024;
+
+    run("cold_err_parse/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+        size_t err_len = 0;
+        string err;
+
+        for (size_t i = 0; i + RECORD_LEN <= v.size(); i += RECORD_LEN) {
+            int64_t id = 0;
+            int64_t qty = 0;
+            int64_t price = 0;
+
+            if (!parse_field_raw(v[i], id, err)
+                || !parse_field_raw(v[i + 1], qty, err)
+                || !parse_field_raw(v[i + 2], price, err)) {
+
+                err_len += err.size();
+                continue;
+            }
+
+            sum += id + qty * price;
+        }
+
+        return sum + static_cast<int64_t>(err_len);
+    });
+
+    run("cold_err_parse/let", ITERATIONS, [&v] {
+        int64_t sum = 0;
+        size_t err_len = 0;
+
+        for (size_t i = 0; i + RECORD_LEN <= v.size(); i += RECORD_LEN) {
+            parse_record(&v[i]).match(
+                [&sum](const int64_t value) { sum += value; },
+                [&err_len](const string &err) { err_len += err.size(); });
+        }
+
+        return sum + static_cast<int64_t>(err_len);
+    });
+
+    // one in every four chunks fails only at its last field
+    run("cold_err_parse/collect", ITERATIONS, [&v] {
+        size_t ok_len = 0;
+        size_t err_len = 0;
+
+        for (size_t i = 0; i + CHUNK_LEN <= v.size(); i += CHUNK_LEN) {
+            const auto chunk = range(i, CHUNK_LEN)
+                               | map([&v](const size_t index) {
+                                     return parse_field(v[index]);
+                                 })
+                               | collect<Result<vector<int64_t>, string>>();
+
+            chunk.match(
+                [&ok_len](const vector<int64_t> &values) {
+                    ok_len += values.size();
+                },
+                [&err_len](const string &err) { err_len += err.size(); });
+        }
+
+        return ok_len + err_len;
+    });
+}
+
+// fails half of the time, and every error gets discarded by unwrap_or
+auto validate_eager(const int64_t value) -> Result<int64_t, string> {
+    if (value % 2 != 0) {
+        return Err("odd value: " + to_string(value));
+    }
+
+    return Ok(value);
+}
+
+auto validate_lazy(const int64_t value) -> Result<int64_t, LazyError> {
+    if (value % 2 != 0) {
+        return Err(LazyError(
+            "odd", [value] { return "odd value: " + to_string(value); }));
+    }
+
+    return Ok(value);
+}
+
+void bench_lazy_err(const vector<int64_t> &v) {
+    run("lazy_err/eager", ITERATIONS, [&v] {
+        return iter(v) | map([](const int64_t value) {
+                   return validate_eager(value).unwrap_or(0);
+               })
+               | fold(int64_t{0}, [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+
+    run("lazy_err/lazy", ITERATIONS, [&v] {
+        return iter(v) | map([](const int64_t value) {
+                   return validate_lazy(value).unwrap_or(0);
+               })
+               | fold(int64_t{0}, [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+}
+
+// every row of the input expands into FANOUT items
+void bench_flat_map(const vector<int64_t> &v) {
+    constexpr size_t FANOUT = 8;
+    constexpr size_t ROWS = LEN / FANOUT;
+
+    vector<vector<int64_t>> rows;
+    rows.reserve(ROWS);
+
+    for (size_t row = 0; row < ROWS; ++row) {
+        const auto first = v.cbegin() + row * FANOUT;
+        rows.emplace_back(first, first + FANOUT);
+    }
+
+    run("flat_map/loop", ITERATIONS, [&rows] {
+        int64_t sum = 0;
+
+        for (const auto &row : rows) {
+            for (const auto value : row) {
+                sum += value;
+            }
+        }
+
+        return sum;
+    });
+
+    // allocates a fresh row for every item of the outer iterator
+    run("flat_map/owned", ITERATIONS, [&rows] {
+        return range(size_t(0), ROWS) | flat_map([&rows](const size_t row) {
+                   return rows[row];
+               })
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+
+    run("flat_map/view", ITERATIONS, [&rows] {
+        return range(size_t(0), ROWS) | flat_map([&rows](const size_t row) {
+                   return cref(rows[row]);
+               })
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+
+    run("flat_map/iterator", ITERATIONS, [&v] {
+        return range(size_t(0), ROWS) | flat_map([&v](const size_t row) {
+                   return range(row * FANOUT, FANOUT)
+                          | map([&v](const size_t i) { return v[i]; });
+               })
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+
+    // advances the sub-iterator in place on every call to next()
+    run("flat_map/iterator_next", ITERATIONS, [&v] {
+        auto it = range(size_t(0), ROWS) | flat_map([&v](const size_t row) {
+                      return range(row * FANOUT, FANOUT)
+                             | map([&v](const size_t i) { return v[i]; });
+                  });
+
+        int64_t sum = 0;
+
+        while (true) {
+            const auto value = it.next();
+
+            if (value.is_none()) {
+                break;
+            }
+
+            sum += value.get_unchecked();
+        }
+
+        return sum;
+    });
+}
+
+// rows of uneven lengths, scanned as one sequence
+void bench_flatten(const vector<int64_t> &v) {
+    vector<vector<int64_t>> rows;
+
+    for (size_t first = 0, len = 1; first < v.size(); first += len++) {
+        const auto last = min(first + len, v.size());
+        rows.emplace_back(v.cbegin() + first, v.cbegin() + last);
+    }
+
+    run("flatten/loop", ITERATIONS, [&rows] {
+        int64_t sum = 0;
+
+        for (const auto &row : rows) {
+            for (const auto value : row) {
+                sum += value;
+            }
+        }
+
+        return sum;
+    });
+
+    // fold runs the loop of each row on its own
+    run("flatten/fold", ITERATIONS, [&rows] {
+        return iter(rows) | flatten()
+               | fold(int64_t(0), [](const int64_t acc, const int64_t value) {
+                     return acc + value;
+                 });
+    });
+
+    run("flatten/next", ITERATIONS, [&rows] {
+        auto it = iter(rows) | flatten();
+        int64_t sum = 0;
+
+        while (true) {
+            const auto value = it.next();
+
+            if (value.is_none()) {
+                break;
+            }
+
+            sum += value.get_unchecked();
+        }
+
+        return sum;
+    });
+}
+
+// sums up the maximum of every chunk of eight values
+void bench_chunks(const vector<int64_t> &v) {
+    constexpr size_t CHUNK_LEN = 8;
+
+    const auto sum_fold = [](const int64_t acc, const int64_t value) {
+        return acc + value;
+    };
+
+    run("chunks/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (size_t first = 0; first < v.size(); first += CHUNK_LEN) {
+            const auto last = min(first + CHUNK_LEN, v.size());
+            int64_t chunk_max = v[first];
+
+            for (size_t i = first + 1; i < last; ++i) {
+                chunk_max = max(chunk_max, v[i]);
+            }
+
+            sum += chunk_max;
+        }
+
+        return sum;
+    });
+
+    run("chunks/slice", ITERATIONS, [&v, &sum_fold] {
+        return iter(v) | chunks(CHUNK_LEN)
+               | map([](const Slice<const int64_t> chunk) {
+                     return *max_element(chunk.begin(), chunk.end());
+                 })
+               | fold(int64_t(0), sum_fold);
+    });
+
+    // items of map are not contiguous, so they are copied into the buffer
+    run("chunks/buffered", ITERATIONS, [&v, &sum_fold] {
+        return range(size_t(0), v.size())
+               | map([&v](const size_t i) { return v[i]; })
+               | chunks(CHUNK_LEN)
+               | map([](const Slice<const int64_t> chunk) {
+                     return *max_element(chunk.begin(), chunk.end());
+                 })
+               | fold(int64_t(0), sum_fold);
+    });
+
+    run("chunks/array", ITERATIONS, [&v, &sum_fold] {
+        return iter(v) | array_chunks<CHUNK_LEN>()
+               | map([](const array<int64_t, CHUNK_LEN> &chunk) {
+                     int64_t chunk_max = chunk[0];
+
+                     for (size_t i = 1; i < CHUNK_LEN; ++i) {
+                         chunk_max = max(chunk_max, chunk[i]);
+                     }
+
+                     return chunk_max;
+                 })
+               | fold(int64_t(0), sum_fold);
+    });
+}
+
+// sums up every window of four consecutive values
+void bench_windows(const vector<int64_t> &v) {
+    constexpr size_t WINDOW_LEN = 4;
+
+    const auto sum_fold = [](const int64_t acc, const int64_t value) {
+        return acc + value;
+    };
+
+    // every variant sums the same four fixed terms per window
+    const auto sum_window = [](const Slice<const int64_t> window) {
+        return window[0] + window[1] + window[2] + window[3];
+    };
+
+    run("windows/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i + WINDOW_LEN <= v.size(); ++i) {
+            sum += v[i] + v[i + 1] + v[i + 2] + v[i + 3];
+        }
+
+        return sum;
+    });
+
+    // every skipped copy of the iterator holds its own pointers
+    run("windows/zip_skip", ITERATIONS, [&v, &sum_fold] {
+        return iter(v) | zip(iter(v) | skip(1)) | zip(iter(v) | skip(2))
+               | zip(iter(v) | skip(3)) | map([](const auto &p) {
+                     return p.first.first.first + p.first.first.second
+                            + p.first.second + p.second;
+                 })
+               | fold(int64_t(0), sum_fold);
+    });
+
+    run("windows/slice", ITERATIONS, [&v, &sum_fold, &sum_window] {
+        return iter(v) | windows(WINDOW_LEN) | map(sum_window)
+               | fold(int64_t(0), sum_fold);
+    });
+
+    // items of map are not contiguous, so they are copied into the ring
+    // buffer
+    run("windows/buffered", ITERATIONS, [&v, &sum_fold, &sum_window] {
+        return range(size_t(0), v.size())
+               | map([&v](const size_t i) { return v[i]; })
+               | windows(WINDOW_LEN) | map(sum_window)
+               | fold(int64_t(0), sum_fold);
+    });
+}
+
+// sums up every fourth value
+void bench_step_by(const vector<int64_t> &v) {
+    constexpr size_t STEP = 4;
+
+    const auto sum_fold = [](const int64_t acc, const int64_t value) {
+        return acc + value;
+    };
+
+    run("step_by/loop", ITERATIONS, [&v] {
+        int64_t sum = 0;
+
+        for (size_t i = 0; i < v.size(); i += STEP) {
+            sum += v[i];
+        }
+
+        return sum;
+    });
+
+    // touches every value to test its index
+    run("step_by/enumerate_filter", ITERATIONS, [&v, &sum_fold] {
+        return iter(v) | enumerate()
+               | filter([](const auto &p) { return p.first % STEP == 0; })
+               | map([](const auto &p) { return p.second; })
+               | fold(int64_t(0), sum_fold);
+    });
+
+    run("step_by/rustfp", ITERATIONS, [&v, &sum_fold] {
+        return iter(v) | step_by(STEP) | fold(int64_t(0), sum_fold);
+    });
+
+    run("step_by/range", ITERATIONS, [&v, &sum_fold] {
+        return range(size_t(0), v.size() / STEP, STEP)
+               | map([&v](const size_t i) { return v[i]; })
+               | fold(int64_t(0), sum_fold);
+    });
+}
+
+// counts the runs of tokens that share the same value
+void bench_peekable(const vector<int64_t> &v) {
+    vector<string> tokens;
+    tokens.reserve(v.size());
+
+    for (const auto value : v) {
+        tokens.push_back(to_string(value / 8));
+    }
+
+    run("peekable/loop", ITERATIONS, [&tokens] {
+        int64_t runs = 0;
+
+        for (size_t i = 0; i < tokens.size(); ++runs) {
+            const auto &token = tokens[i];
+
+            for (++i; i < tokens.size() && tokens[i] == token; ++i) {
+            }
+        }
+
+        return runs;
+    });
+
+    // the peeked tokens are references into the vector, never copies
+    run("peekable/next_if", ITERATIONS, [&tokens] {
+        auto it = iter(tokens) | peekable();
+        int64_t runs = 0;
+
+        while (true) {
+            const auto token_opt = it.next();
+
+            if (token_opt.is_none()) {
+                break;
+            }
+
+            const auto &token = token_opt.get_unchecked();
+
+            while (it.next_if([&token](const string &next_token) {
+                         return next_token == token;
+                     })
+                       .is_some()) {
+            }
+
+            ++runs;
+        }
+
+        return runs;
+    });
+}
+
+// sums up the values of both halves of the input as one sequence
+void bench_chain(const vector<int64_t> &v) {
+    const auto mid = v.cbegin() + v.size() / 2;
+    const vector<int64_t> front(v.cbegin(), mid);
+    const vector<int64_t> back(mid, v.cend());
+
+    const auto sum_fold = [](const int64_t acc, const int64_t value) {
+        return acc + value;
+    };
+
+    run("chain/loop", ITERATIONS, [&front, &back] {
+        int64_t sum = 0;
+
+        for (const auto value : front) {
+            sum += value;
+        }
+
+        for (const auto value : back) {
+            sum += value;
+        }
+
+        return sum;
+    });
+
+    // allocates and copies both halves into one vector first
+    run("chain/collect", ITERATIONS, [&front, &back, &sum_fold] {
+        auto joined = iter(front) | collect<vector<int64_t>>();
+        joined.insert(joined.end(), back.cbegin(), back.cend());
+        return iter(joined) | fold(int64_t(0), sum_fold);
+    });
+
+    // runs the fold of each half back to back
+    run("chain/fold", ITERATIONS, [&front, &back, &sum_fold] {
+        return iter(front) | chain(iter(back)) | fold(int64_t(0), sum_fold);
+    });
+
+    // checks the state flag on every item
+    run("chain/next", ITERATIONS, [&front, &back] {
+        auto it = iter(front) | chain(iter(back));
+        int64_t sum = 0;
+
+        while (true) {
+            const auto value = it.next();
+
+            if (value.is_none()) {
+                break;
+            }
+
+            sum += value.get_unchecked();
+        }
+
+        return sum;
+    });
+}
+} // namespace
+
+int main() {
+    const auto v = make_input();
+
+    bench_map_filter_fold(v);
+    bench_range_take_fold();
+    bench_for_each(v);
+    bench_short_circuit(v);
+    bench_skip_take(v);
+    bench_rev_filter_take(v);
+    bench_collect(v);
+    bench_zip_dot(v);
+    bench_filter_find(v);
+    bench_stacked_next(v);
+    bench_let_parse(v);
+    bench_cold_err_parse(v);
+    bench_lazy_err(v);
+    bench_flat_map(v);
+    bench_flatten(v);
+    bench_chunks(v);
+    bench_windows(v);
+    bench_step_by(v);
+    bench_peekable(v);
+    bench_chain(v);
+}
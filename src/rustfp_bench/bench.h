@@ -0,0 +1,127 @@
+/**
+ * Contains a minimal timing harness for comparing rustfp pipelines against
+ * their hand-written loop equivalents.
+ *
+ * @author Chen Weiguang
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+
+// keeps a function out of line, starting on a cache line where supported
+#if defined(__GNUC__) || defined(__clang__)
+#define RUSTFP_BENCH_ALIGNED_NOINLINE __attribute__((noinline, aligned(64)))
+#elif defined(_MSC_VER)
+#define RUSTFP_BENCH_ALIGNED_NOINLINE __declspec(noinline)
+#else
+#define RUSTFP_BENCH_ALIGNED_NOINLINE
+#endif
+
+namespace rustfp {
+namespace bench {
+
+// declaration section
+
+/**
+ * Prevents the compiler from optimizing away the computation of value.
+ * @tparam T Type of value
+ * @param value Value to keep alive
+ */
+template <class T>
+void do_not_optimize(const T &value);
+
+/**
+ * Prevents the compiler from optimizing away the computation of value, and
+ * from assuming anything about value afterwards, such as it being a constant.
+ * @tparam T Type of value
+ * @param value Value to keep alive and make opaque
+ */
+template <class T>
+void do_not_optimize(T &value);
+
+/**
+ * Runs f for the given number of iterations over a few rounds, and prints the
+ * fastest average time taken per iteration.
+ * @tparam F Function type, where F: () -> T
+ * @param name Name of the benchmark to print
+ * @param iterations Number of times to run f in each round
+ * @param f Function to benchmark, whose return value is kept alive
+ */
+template <class F>
+void run(const std::string &name, const size_t iterations, F &&f);
+
+// implementation section
+
+namespace details {
+constexpr size_t ROUNDS = 5;
+constexpr int NAME_WIDTH = 48;
+
+// every benchmark is timed in its own function starting on a cache line, so
+// that the same loop is laid out the same way in every benchmark, otherwise
+// a loop that happens to straddle a boundary can run at half the speed of the
+// same instructions elsewhere
+template <class F>
+RUSTFP_BENCH_ALIGNED_NOINLINE auto time_round(
+    const size_t iterations, F &f) -> std::chrono::steady_clock::duration {
+
+    using clock = std::chrono::steady_clock;
+
+    const auto start = clock::now();
+
+    for (size_t i = 0; i < iterations; ++i) {
+        const auto value = f();
+        do_not_optimize(value);
+    }
+
+    return clock::now() - start;
+}
+} // namespace details
+
+template <class T>
+void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const auto sink = reinterpret_cast<const volatile char *>(&value);
+    static_cast<void>(*sink);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+template <class T>
+void do_not_optimize(T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(value) : : "memory");
+#else
+    const auto sink = reinterpret_cast<volatile char *>(&value);
+    *sink = *sink;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+template <class F>
+void run(const std::string &name, const size_t iterations, F &&f) {
+    auto best = std::chrono::steady_clock::duration::max();
+
+    for (size_t round = 0; round < details::ROUNDS; ++round) {
+        best = std::min(best, details::time_round(iterations, f));
+    }
+
+    const auto ns_per_iter =
+        std::chrono::duration<double, std::nano>(best).count() / iterations;
+
+    std::cout << std::left << std::setw(details::NAME_WIDTH) << name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << ns_per_iter << " ns/iter" << std::endl;
+}
+} // namespace bench
+} // namespace rustfp
@@ -3,6 +3,8 @@
 #define RUSTFP_SIMPLIFIED_LET
 #include "rustfp/all.h"
 #include "rustfp/any.h"
+#include "rustfp/chain.h"
+#include "rustfp/chunks.h"
 #include "rustfp/cloned.h"
 #include "rustfp/collect.h"
 #include "rustfp/cycle.h"
@@ -12,28 +14,43 @@
 #include "rustfp/find.h"
 #include "rustfp/find_map.h"
 #include "rustfp/flat_map.h"
+#include "rustfp/flatten.h"
 #include "rustfp/fold.h"
 #include "rustfp/for_each.h"
 #include "rustfp/iter.h"
+#include "rustfp/iterator.h"
+#include "rustfp/lazy_error.h"
 #include "rustfp/let.h"
 #include "rustfp/map.h"
 #include "rustfp/max.h"
 #include "rustfp/min.h"
+#include "rustfp/nth.h"
 #include "rustfp/once.h"
 #include "rustfp/option.h"
+#include "rustfp/peekable.h"
 #include "rustfp/range.h"
 #include "rustfp/result.h"
+#include "rustfp/rev.h"
 #include "rustfp/skip.h"
+#include "rustfp/slice.h"
+#include "rustfp/std_iter.h"
+#include "rustfp/step_by.h"
 #include "rustfp/take.h"
 #include "rustfp/unit.h"
+#include "rustfp/windows.h"
 #include "rustfp/zip.h"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <deque>
+#include <forward_list>
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -42,6 +59,7 @@
 #include <set>
 #include <sstream>
 #include <stack>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -49,9 +67,20 @@
 #include <utility>
 #include <vector>
 
+#if !defined(NDEBUG) && defined(__unix__)
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 // rustfp
 using rustfp::all;
 using rustfp::any;
+using rustfp::array_chunks;
+using rustfp::chain;
+using rustfp::chunks;
 using rustfp::cloned;
 using rustfp::collect;
 using rustfp::cycle;
@@ -61,6 +90,7 @@ using rustfp::filter_map;
 using rustfp::find;
 using rustfp::find_map;
 using rustfp::flat_map;
+using rustfp::flatten;
 using rustfp::fold;
 using rustfp::for_each;
 using rustfp::into_iter;
@@ -72,21 +102,35 @@ using rustfp::max;
 using rustfp::max_by;
 using rustfp::min;
 using rustfp::min_by;
+using rustfp::nth;
 using rustfp::once;
+using rustfp::peekable;
 using rustfp::range;
+using rustfp::rev;
 using rustfp::skip;
+using rustfp::step_by;
 using rustfp::take;
+using rustfp::windows;
 using rustfp::zip;
 
 using rustfp::Unit;
 using rustfp::unit_t;
 
+using rustfp::make_some;
 using rustfp::None;
 using rustfp::opt_if;
 using rustfp::Option;
 using rustfp::Some;
 
+using rustfp::ContiguousIter;
+using rustfp::Iter;
+using rustfp::Slice;
+using rustfp::size_hint_t;
+
 using rustfp::Err;
+using rustfp::LazyError;
+using rustfp::make_err;
+using rustfp::make_ok;
 using rustfp::Ok;
 using rustfp::res_if_else;
 using rustfp::Result;
@@ -99,6 +143,7 @@ using std::cend;
 using std::cout;
 using std::cref;
 using std::deque;
+using std::forward_list;
 using std::extent;
 using std::forward;
 using std::is_same;
@@ -179,10 +224,207 @@ auto similar_values(IterableLhs &&lhs, IterableRhs &&rhs, CompFn &&comp_fn)
 
     return true;
 }
+
+auto same_size_hint(
+    const size_hint_t &hint, const size_t lower, const Option<size_t> &upper)
+    -> bool {
+
+    return hint.first == lower && hint.second.is_some() == upper.is_some()
+           && (upper.is_none()
+               || hint.second.get_unchecked() == upper.get_unchecked());
+}
+
+#if !defined(NDEBUG) && defined(__unix__)
+// runs f in a forked child process, and checks if it aborts, such as on a
+// failed assert
+template <class F>
+auto aborts(F &&f) -> bool {
+    const auto pid = fork();
+
+    if (pid == 0) {
+        // silences the assert message of the child
+        static_cast<void>(std::freopen("/dev/null", "w", stderr));
+        static_cast<void>(f());
+        std::_Exit(0);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT;
+}
+#endif
 } // namespace details
 
 // simple ops
 
+// types with a sentinel value for Option to represent None
+
+enum class SlotIndex : uint32_t {};
+
+struct Meters {
+    double value;
+};
+
+enum class ErrorCode : uint8_t { NotFound, Invalid, Unknown = UINT8_MAX };
+
+namespace rustfp {
+template <>
+struct option_niche<SlotIndex>
+    : option_niche_sentinel<SlotIndex, static_cast<SlotIndex>(UINT32_MAX)> {
+};
+
+template <>
+struct option_niche<ErrorCode>
+    : option_niche_sentinel<ErrorCode, ErrorCode::Unknown> {};
+
+template <>
+struct option_niche<Meters> : std::true_type {
+    static auto none_value() -> Meters {
+        return Meters{std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    static auto is_none(const Meters &meters) -> bool {
+        return std::isnan(meters.value);
+    }
+};
+} // namespace rustfp
+
+// function objects usable in constant expressions, since lambdas only become
+// constexpr in C++17
+
+struct Square {
+    constexpr auto operator()(const int value) const -> int {
+        return value * value;
+    }
+};
+
+struct IsEven {
+    constexpr auto operator()(const int value) const -> bool {
+        return value % 2 == 0;
+    }
+};
+
+// counts every copy and move of itself, to check for in place construction
+class Tracked {
+public:
+    Tracked(size_t &copy_moves, const int value)
+        : copy_moves(&copy_moves), value(value) {
+    }
+
+    Tracked(const Tracked &rhs)
+        : copy_moves(rhs.copy_moves), value(rhs.value) {
+
+        ++*copy_moves;
+    }
+
+    Tracked(Tracked &&rhs) : copy_moves(rhs.copy_moves), value(rhs.value) {
+        ++*copy_moves;
+    }
+
+    auto get() const -> int {
+        return value;
+    }
+
+private:
+    size_t *copy_moves;
+    int value;
+};
+
+// throws when copied, but can be moved without throwing
+class ThrowOnCopy {
+public:
+    explicit ThrowOnCopy(const int value) : value(value) {
+    }
+
+    ThrowOnCopy(const ThrowOnCopy &rhs) : value(rhs.value) {
+        throw std::runtime_error("ThrowOnCopy is copied");
+    }
+
+    ThrowOnCopy(ThrowOnCopy &&rhs) RUSTFP_NOEXCEPT : value(rhs.value) {
+    }
+
+    auto operator=(const ThrowOnCopy &rhs) -> ThrowOnCopy & {
+        value = rhs.value;
+        throw std::runtime_error("ThrowOnCopy is copied");
+    }
+
+    auto operator=(ThrowOnCopy &&rhs) RUSTFP_NOEXCEPT -> ThrowOnCopy & {
+        value = rhs.value;
+        return *this;
+    }
+
+    auto get() const -> int {
+        return value;
+    }
+
+private:
+    int value;
+};
+
+// counts its moves, which cannot throw
+class MoveCounted {
+public:
+    explicit MoveCounted(size_t &moves) : moves(&moves) {
+    }
+
+    MoveCounted(MoveCounted &&rhs) RUSTFP_NOEXCEPT : moves(rhs.moves) {
+        ++*moves;
+    }
+
+    auto operator=(MoveCounted &&rhs) RUSTFP_NOEXCEPT -> MoveCounted & {
+        moves = rhs.moves;
+        ++*moves;
+        return *this;
+    }
+
+private:
+    size_t *moves;
+};
+
+// can neither be copied nor moved
+class Pinned {
+public:
+    explicit Pinned(const int value) : value(value) {
+    }
+
+    Pinned(const Pinned &) = delete;
+    Pinned(Pinned &&) = delete;
+
+    auto get() const -> int {
+        return value;
+    }
+
+private:
+    int value;
+};
+
+constexpr auto take_then_refill(const int value) -> int {
+    auto opt = Some(value);
+    const auto taken = opt.take().unwrap_or(0);
+    opt = Some(taken * 2);
+    return taken + std::move(opt).unwrap_or(0);
+}
+
+constexpr auto flip_to_err(const int value) -> Result<int, int> {
+    auto res = Result<int, int>(Ok(value));
+    res = Err(value + 1);
+    return res;
+}
+
+// the formatter only captures what outlives this function, since the error is
+// returned out of it
+auto parse_digit(const char c) -> Result<int, LazyError> {
+    if (c < '0' || c > '9') {
+        const char *const kind = "digit";
+
+        return Err(LazyError("not a digit", [c, kind] {
+            return string("not a ") + kind + ": " + c;
+        }));
+    }
+
+    return Ok(c - '0');
+}
+
 TEST_CASE("Ops section", "[Ops]") {
     const auto int_vec = vector<int>{0, 1, 2, 3, 4, 5};
 
@@ -692,6 +934,29 @@ TEST_CASE("Ops section", "[Ops]") {
         }
     }
 
+    SECTION("CollectArray") {
+        const auto arr = iter(int_vec) | cloned() | collect<array<int, 4>>();
+        REQUIRE(details::no_mismatch_values(array<int, 4>{0, 1, 2, 3}, arr));
+
+        const auto padded =
+            iter(int_vec) | cloned() | collect<array<int, 8>>();
+
+        REQUIRE(details::no_mismatch_values(
+            array<int, 8>{0, 1, 2, 3, 4, 5, 0, 0}, padded));
+    }
+
+    SECTION("CollectArrayConstexpr") {
+        constexpr auto squares =
+            range(1, 4) | map(Square()) | collect<array<int, 6>>();
+
+        static_assert(
+            squares[0] == 1 && squares[3] == 16 && squares[5] == 0,
+            "collected array is expected to be a constant");
+
+        REQUIRE(details::no_mismatch_values(
+            array<int, 6>{1, 4, 9, 16, 0, 0}, squares));
+    }
+
     SECTION("CollectResultOk") {
         vector<Result<int, string>> res_vec{Ok(0), Ok(1), Ok(2)};
 
@@ -726,6 +991,36 @@ TEST_CASE("Ops section", "[Ops]") {
         REQUIRE(err_msg == collected);
     }
 
+    SECTION("CollectResultLazyErr") {
+        size_t format_count = 0;
+
+        const auto parse = [&format_count](const int value)
+            -> Result<int, LazyError> {
+
+            if (value < 0) {
+                return Err(LazyError("negative", [&format_count, value] {
+                    ++format_count;
+                    return "negative value: " + to_string(value);
+                }));
+            }
+
+            return Ok(value);
+        };
+
+        auto collected_res =
+            iter(int_vec)
+            | map([&parse](const int value) { return parse(value - 3); })
+            | collect<Result<vector<int>, LazyError>>();
+
+        REQUIRE(collected_res.is_err());
+        REQUIRE(0 == format_count);
+
+        const auto err = move(collected_res).unwrap_err_unchecked();
+        REQUIRE(string("negative") == err.code());
+        REQUIRE("negative value: -3" == err.message());
+        REQUIRE(1 == format_count);
+    }
+
     SECTION("CollectVecRef") {
         const auto str_ref_vec =
             iter(str_vec) | collect<vector<reference_wrapper<const string>>>();
@@ -806,6 +1101,19 @@ TEST_CASE("Ops section", "[Ops]") {
 
         REQUIRE(1 == vec.size());
         REQUIRE("Hello" == *vec[0]);
+
+        auto once_it = once(0);
+        REQUIRE(once_it.next().is_some());
+        REQUIRE(once_it.next().is_none());
+    }
+
+    SECTION("OnceTrivial") {
+        // moving out of an Option of a trivially copyable item leaves it
+        // engaged, so once must take the item out instead
+        const auto vec = once(7) | take(5) | collect<vector<int>>();
+
+        REQUIRE(1 == vec.size());
+        REQUIRE(7 == vec[0]);
     }
 
     SECTION("Enumerate") {
@@ -919,6 +1227,32 @@ TEST_CASE("Ops section", "[Ops]") {
         REQUIRE(find_none_opt.is_none());
     }
 
+    SECTION("FindZip") {
+        const auto rev_vec = vector<int>{5, 4, 3, 2, 1, 0};
+
+        // zip item is a pair of references, which cannot be assigned
+        const auto find_some_opt =
+            iter(int_vec) | zip(iter(rev_vec))
+            | find([](const auto &pair) { return pair.first > pair.second; });
+
+        REQUIRE(find_some_opt.is_some());
+        REQUIRE(3 == find_some_opt.get_unchecked().first);
+        REQUIRE(&rev_vec[3] == &find_some_opt.get_unchecked().second);
+    }
+
+    SECTION("FindMapZip") {
+        const auto rev_vec = vector<int>{5, 4, 3, 2, 1, 0};
+
+        const auto find_some_opt =
+            iter(int_vec) | zip(iter(rev_vec)) | find_map([](auto pair) {
+                return pair.first == pair.second + 1 ? Some(pair) : None;
+            });
+
+        REQUIRE(find_some_opt.is_some());
+        REQUIRE(&int_vec[3] == &find_some_opt.get_unchecked().first);
+        REQUIRE(2 == find_some_opt.get_unchecked().second);
+    }
+
     SECTION("FlatMapEmpty") {
         auto vv = vector<vector<int>>{};
 
@@ -952,182 +1286,620 @@ TEST_CASE("Ops section", "[Ops]") {
             array<int, 6>{0, 1, 2, 3, 4, 5}, v_out));
     }
 
-    SECTION("Fold") {
-        const auto fold_sum = iter(int_vec) | fold(10, plus<int>());
+    SECTION("FlatMapIterator") {
+        const int offset = 10;
 
-        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 10) == fold_sum);
-    }
+        // the closure within map cannot be assigned, so the sub-iterator must
+        // be constructed and advanced in place
+        auto it = range(1, 3) | flat_map([offset](const int value) {
+                      return range(0, value) | map([offset](const int v) {
+                                 return v + offset;
+                             });
+                  });
 
-    SECTION("ForEach") {
-        int sum = 0;
+        static_assert(
+            is_same<decltype(it)::Item, int>::value,
+            "Item is expected to be of int type");
 
-        iter(int_vec) | for_each([&sum](const auto value) {
-            static_assert(
-                is_same<decltype(value), const int>::value,
-                "value is expected to be of const int type");
+        REQUIRE(it.next().unwrap_unchecked() == 10);
+        REQUIRE(it.next().unwrap_unchecked() == 10);
+        REQUIRE(it.next().unwrap_unchecked() == 11);
 
-            sum += value;
-        });
+        const auto v_out = move(it) | collect<vector<int>>();
 
-        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) == sum);
+        REQUIRE(details::no_mismatch_values(
+            array<int, 3>{10, 11, 12}, v_out));
     }
 
-    SECTION("Map") {
-        double sum = 0.0;
-
-        iter(int_vec) | map([](const auto value) {
-            static_assert(
-                is_same<decltype(value), const int>::value,
-                "value is expected to be of const int type");
+    SECTION("FlatMapRef") {
+        const auto vv = vector<vector<int>>{{0, 1}, {}, {2, 3, 4}};
 
-            return value * 0.5;
-        }) | for_each([&sum](const auto value) {
-            static_assert(
-                is_same<decltype(value), const double>::value,
-                "value is expected to be of const double type");
+        const auto ptr_out = range(0, vv.size())
+                             | flat_map([&vv](const size_t i) {
+                                   return cref(vv[i]);
+                               })
+                             | map([](const int &v) { return &v; })
+                             | collect<vector<const int *>>();
 
-            sum += value;
-        });
+        REQUIRE(ptr_out.size() == 5);
+        REQUIRE(ptr_out[0] == &vv[0][0]);
+        REQUIRE(ptr_out[1] == &vv[0][1]);
+        REQUIRE(ptr_out[2] == &vv[2][0]);
+        REQUIRE(ptr_out[4] == &vv[2][2]);
 
-        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) * 0.5 == sum);
-    }
+        const auto sum =
+            range(0, vv.size())
+            | flat_map([&vv](const size_t i) -> const vector<int> & {
+                  return vv[i];
+              })
+            | fold(0, plus<int>());
 
-    SECTION("MaxNone") {
-        const vector<int> VALS;
-        const auto max_opt = iter(VALS) | max();
-        REQUIRE(max_opt.is_none());
+        REQUIRE(sum == 10);
     }
 
-    SECTION("MaxSomeEasy") {
-        const vector<string> VALS{"zzz", "hello", "world"};
-        const auto max_opt = iter(VALS) | max();
-
-        REQUIRE(max_opt.is_some());
-        REQUIRE("zzz" == max_opt.get_unchecked());
-    }
+    SECTION("Flatten") {
+        const auto vv = vector<vector<int>>{{0, 1}, {}, {2, 3, 4}};
 
-    SECTION("MaxSomeHard") {
-        const vector<int> VALS{-5, 1, 777, 123, 25, 0, 777, 777};
+        const auto ptr_out = iter(vv) | flatten()
+                             | map([](const int &v) { return &v; })
+                             | collect<vector<const int *>>();
 
-        // hand coded max to get the address eventually
-        REQUIRE(!VALS.empty());
+        REQUIRE(ptr_out.size() == 5);
+        REQUIRE(ptr_out[0] == &vv[0][0]);
+        REQUIRE(ptr_out[2] == &vv[2][0]);
+        REQUIRE(ptr_out[4] == &vv[2][2]);
 
-        size_t max_index = 0;
+        REQUIRE((iter(vv) | flatten() | fold(0, plus<int>())) == 10);
 
-        for (size_t i = 1; i < VALS.size(); ++i) {
-            if (VALS[i] > VALS[max_index]) {
-                max_index = i;
-            }
-        }
+        auto owned_vv = vector<vector<int>>{{5}, {6, 7}};
 
-        // found the value and referencing it
-        const auto &max_val = VALS[max_index];
-        const auto max_opt = iter(VALS) | max();
+        const auto v_out =
+            into_iter(move(owned_vv)) | flatten() | collect<vector<int>>();
 
-        REQUIRE(max_opt.is_some());
-        REQUIRE(777 == max_opt.get_unchecked());
-        REQUIRE(&max_val == &max_opt.get_unchecked());
+        REQUIRE(details::no_mismatch_values(array<int, 3>{5, 6, 7}, v_out));
     }
 
-    SECTION("MaxByNone") {
-        const vector<int> VALS;
+    SECTION("FlattenIterators") {
+        auto it = range(1, 3)
+                  | map([](const int value) { return range(0, value); })
+                  | flatten();
 
-        const auto max_opt =
-            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
-                static_assert(
-                    is_same<decltype(lhs), const int>::value,
-                    "lhs is expected to be of const int type");
+        static_assert(
+            is_same<decltype(it)::Item, int>::value,
+            "Item is expected to be of int type");
 
-                static_assert(
-                    is_same<decltype(rhs), const int>::value,
-                    "rhs is expected to be of const int type");
+        REQUIRE(it.next().unwrap_unchecked() == 0);
 
-                return lhs >= rhs;
-            });
+        const auto v_out = move(it) | collect<vector<int>>();
 
-        REQUIRE(max_opt.is_none());
+        REQUIRE(details::no_mismatch_values(
+            array<int, 5>{0, 1, 0, 1, 2}, v_out));
     }
 
-    SECTION("MaxBySomeEasy") {
-        const vector<int> VALS{3, 1, 2};
+    SECTION("FlattenOption") {
+        const auto opts = vector<Option<int>>{Some(1), None, Some(3)};
 
-        const auto max_opt =
-            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
-                static_assert(
-                    is_same<decltype(lhs), const int>::value,
-                    "lhs is expected to be of const int type");
+        auto ref_it = iter(opts) | flatten();
 
-                static_assert(
-                    is_same<decltype(rhs), const int>::value,
-                    "rhs is expected to be of const int type");
+        static_assert(
+            is_same<decltype(ref_it)::Item, const int &>::value,
+            "Item is expected to be of const int & type");
 
-                return lhs >= rhs;
-            });
+        REQUIRE(&ref_it.next().get_unchecked() == &opts[0].get_unchecked());
+        REQUIRE(&ref_it.next().get_unchecked() == &opts[2].get_unchecked());
+        REQUIRE(ref_it.next().is_none());
 
-        REQUIRE(max_opt.is_some());
-        REQUIRE(3 == max_opt.get_unchecked());
+        const auto v_out = range(0, 5) | map([](const int value) {
+                               return value % 2 == 0 ? Some(value) : None;
+                           })
+                           | flatten() | collect<vector<int>>();
+
+        REQUIRE(details::no_mismatch_values(array<int, 3>{0, 2, 4}, v_out));
     }
 
-    SECTION("MaxBySomeHard") {
-        const vector<int> VALS{5, 2, 7, 3, 3, 2, 2, 9};
+    SECTION("Chunks") {
+        auto it = iter(int_vec) | chunks(4);
 
-        // hand coded max to get the address eventually
-        REQUIRE(!VALS.empty());
+        static_assert(
+            is_same<decltype(it)::Item, Slice<const int>>::value,
+            "Item is expected to be of Slice<const int> type");
 
-        size_t max_index = 0;
+        REQUIRE(it.len() == 2);
 
-        for (size_t i = 1; i < VALS.size(); ++i) {
-            if (VALS[i] > VALS[max_index]) {
-                max_index = i;
-            }
-        }
+        const auto first = it.next().unwrap_unchecked();
+        REQUIRE(first.data() == int_vec.data());
+        REQUIRE(first.size() == 4);
 
-        // found the value and referencing it
-        const auto &max_val = VALS[max_index];
+        const auto last = it.next().unwrap_unchecked();
+        REQUIRE(last.data() == int_vec.data() + 4);
+        REQUIRE(last.size() == 2);
+        REQUIRE((iter(last) | fold(0, plus<int>())) == 9);
 
-        const auto max_opt =
-            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
-                static_assert(
-                    is_same<decltype(lhs), const int>::value,
-                    "lhs is expected to be of const int type");
+        REQUIRE(it.len() == 0);
+        REQUIRE(it.next().is_none());
+    }
 
-                static_assert(
-                    is_same<decltype(rhs), const int>::value,
-                    "rhs is expected to be of const int type");
+    SECTION("ChunksBuffered") {
+        auto it = range(0, 7) | chunks(3);
 
-                return lhs >= rhs;
-            });
+        static_assert(
+            is_same<decltype(it)::Item, Slice<const int>>::value,
+            "Item is expected to be of Slice<const int> type");
 
-        REQUIRE(max_opt.is_some());
-        REQUIRE(9 == max_opt.get_unchecked());
-        REQUIRE(&max_val == &max_opt.get_unchecked());
-    }
+        REQUIRE(details::same_size_hint(it.size_hint(), 3, Some(3)));
 
-    SECTION("MinNone") {
-        const vector<int> VALS;
-        const auto min_opt = iter(VALS) | min();
+        const auto sums = move(it) | map([](const Slice<const int> chunk) {
+                              return accumulate(chunk.begin(), chunk.end(), 0);
+                          })
+                          | collect<vector<int>>();
 
-        REQUIRE(min_opt.is_none());
+        REQUIRE(details::no_mismatch_values(array<int, 3>{3, 12, 6}, sums));
     }
 
-    SECTION("MinSomeEasy") {
-        const vector<string> VALS{"hello", "world", "zzz"};
-        const auto min_opt = iter(VALS) | min();
+    SECTION("ArrayChunks") {
+        auto it = iter(int_vec) | array_chunks<4>();
 
-        REQUIRE(min_opt.is_some());
-        REQUIRE("hello" == min_opt.get_unchecked());
+        static_assert(
+            is_same<decltype(it)::Item, array<int, 4>>::value,
+            "Item is expected to be of array<int, 4> type");
+
+        REQUIRE(it.len() == 1);
+        REQUIRE(it.next().unwrap_unchecked() == (array<int, 4>{0, 1, 2, 3}));
+        REQUIRE(it.next().is_none());
+
+        const auto pairs = range(0, 7)
+                           | filter([](const int v) { return v > 0; })
+                           | array_chunks<2>()
+                           | collect<vector<array<int, 2>>>();
+
+        REQUIRE(pairs.size() == 3);
+        REQUIRE(pairs[0] == (array<int, 2>{1, 2}));
+        REQUIRE(pairs[2] == (array<int, 2>{5, 6}));
     }
 
-    SECTION("MinSomeHard") {
-        const vector<int> VALS{-5, 1, -777, 123, 25, 0, -777, -777};
+    SECTION("Windows") {
+        auto it = iter(int_vec) | windows(4);
 
-        // hand coded min to get the address eventually
-        REQUIRE(!VALS.empty());
+        static_assert(
+            is_same<decltype(it)::Item, Slice<const int>>::value,
+            "Item is expected to be of Slice<const int> type");
 
-        size_t min_index = 0;
+        REQUIRE(it.len() == 3);
+        REQUIRE(details::same_size_hint(it.size_hint(), 3, Some(3)));
 
-        for (size_t i = 1; i < VALS.size(); ++i) {
-            if (VALS[i] < VALS[min_index]) {
+        for (size_t i = 0; i < 3; ++i) {
+            const auto window = it.next().unwrap_unchecked();
+            REQUIRE(window.data() == int_vec.data() + i);
+            REQUIRE(window.size() == 4);
+        }
+
+        REQUIRE(it.len() == 0);
+        REQUIRE(it.next().is_none());
+        REQUIRE((iter(int_vec) | windows(7)).len() == 0);
+
+        const auto sum_window = [](const Slice<const int> window) {
+            return accumulate(window.begin(), window.end(), 0);
+        };
+
+        auto fold_it = iter(int_vec) | windows(3);
+        REQUIRE(fold_it.at_unchecked(1).data() == int_vec.data() + 1);
+        REQUIRE(sum_window(fold_it.next().unwrap_unchecked()) == 3);
+        REQUIRE(sum_window(fold_it.at_unchecked(0)) == 6);
+
+        REQUIRE(
+            fold_it.fold(
+                0,
+                [&sum_window](const int acc, const Slice<const int> window) {
+                    return acc + sum_window(window);
+                })
+            == 27);
+
+        REQUIRE(fold_it.len() == 0);
+        REQUIRE(fold_it.next().is_none());
+
+        REQUIRE(
+            (iter(int_vec) | windows(7) | map(sum_window)
+             | fold(0, plus<int>()))
+            == 0);
+    }
+
+    SECTION("WindowsBuffered") {
+        const auto sum_window = [](const Slice<const int> window) {
+            return accumulate(window.begin(), window.end(), 0);
+        };
+
+        auto it = range(0, 6) | windows(3);
+
+        static_assert(
+            is_same<decltype(it)::Item, Slice<const int>>::value,
+            "Item is expected to be of Slice<const int> type");
+
+        REQUIRE(it.len() == 4);
+        REQUIRE(sum_window(it.next().unwrap_unchecked()) == 3);
+        REQUIRE(it.len() == 3);
+
+        const auto sums = move(it) | map(sum_window) | collect<vector<int>>();
+
+        REQUIRE(details::no_mismatch_values(array<int, 3>{6, 9, 12}, sums));
+
+        auto short_it = range(0, 2) | windows(3);
+        REQUIRE(short_it.len() == 0);
+        REQUIRE(short_it.next().is_none());
+    }
+
+    SECTION("StepBy") {
+        auto it = iter(int_vec) | step_by(2);
+
+        REQUIRE(it.len() == 3);
+        REQUIRE(it.next().unwrap_unchecked() == 0);
+        REQUIRE(it.len() == 2);
+        REQUIRE(it.next().unwrap_unchecked() == 2);
+        REQUIRE(it.next().unwrap_unchecked() == 4);
+        REQUIRE(it.len() == 0);
+        REQUIRE(it.next().is_none());
+
+        const auto v_out = range(0, 10) | step_by(3) | collect<vector<int>>();
+
+        REQUIRE(details::no_mismatch_values(array<int, 4>{0, 3, 6, 9}, v_out));
+
+        REQUIRE(details::same_size_hint(
+            (range(0, 10) | filter([](const int) { return true; })
+             | step_by(4))
+                .size_hint(),
+            0,
+            Some(3)));
+
+        REQUIRE((range(0, 0) | step_by(2)).len() == 0);
+
+        auto fold_it = iter(int_vec) | step_by(4);
+        REQUIRE(fold_it.next().unwrap_unchecked() == 0);
+        REQUIRE((move(fold_it) | fold(0, plus<int>())) == 4);
+    }
+
+    SECTION("RangeStep") {
+        auto it = range(10, 4, -3);
+
+        REQUIRE(it.len() == 4);
+        REQUIRE(it.at_unchecked(3) == 1);
+        REQUIRE(it.next().unwrap_unchecked() == 10);
+        REQUIRE(it.next_back().unwrap_unchecked() == 1);
+        REQUIRE(it.len() == 2);
+
+        const auto v_out = move(it) | collect<vector<int>>();
+        REQUIRE(details::no_mismatch_values(array<int, 2>{7, 4}, v_out));
+
+        const auto unsigned_out =
+            range(size_t(6), 4, -2) | collect<vector<size_t>>();
+
+        REQUIRE(details::no_mismatch_values(
+            array<size_t, 4>{6, 4, 2, 0}, unsigned_out));
+
+        auto ascending_it = range(1, 5, 2);
+        REQUIRE(ascending_it.advance_by(2).is_ok());
+        REQUIRE(ascending_it.next().unwrap_unchecked() == 5);
+        REQUIRE((move(ascending_it) | fold(0, plus<int>())) == 16);
+    }
+
+    SECTION("Peekable") {
+        const auto tokens = vector<string>{"let", "x", "=", "1"};
+        auto it = iter(tokens) | peekable();
+
+        static_assert(
+            is_same<decltype(it.peek()), Option<const string &>>::value,
+            "peek() is expected to return Option<const string &>");
+
+        REQUIRE(it.len() == 4);
+        REQUIRE(&it.peek().get_unchecked() == &tokens[0]);
+        REQUIRE(&it.peek().get_unchecked() == &tokens[0]);
+        REQUIRE(it.len() == 4);
+        REQUIRE(&it.next().get_unchecked() == &tokens[0]);
+
+        const auto is_eq = [](const string &token) { return token == "="; };
+
+        REQUIRE(it.next_if(is_eq).is_none());
+        REQUIRE(&it.peek().get_unchecked() == &tokens[1]);
+        REQUIRE(&it.next().get_unchecked() == &tokens[1]);
+        REQUIRE(&it.next_if(is_eq).get_unchecked() == &tokens[2]);
+        REQUIRE(it.len() == 1);
+
+        REQUIRE(it.peek().get_unchecked() == "1");
+
+        const auto joined =
+            move(it) | fold(string(), [](string acc, const string &token) {
+                return acc + token;
+            });
+
+        REQUIRE(joined == "1");
+    }
+
+    SECTION("PeekableGroup") {
+        auto it = range(0, 10) | map([](const int v) { return v / 4; })
+                  | peekable();
+
+        vector<int> run_lens;
+
+        while (true) {
+            const auto key_opt = it.next();
+
+            if (key_opt.is_none()) {
+                break;
+            }
+
+            const auto key = key_opt.get_unchecked();
+            int run_len = 1;
+
+            while (it.next_if([key](const int v) { return v == key; })
+                       .is_some()) {
+                ++run_len;
+            }
+
+            run_lens.push_back(run_len);
+        }
+
+        REQUIRE(details::no_mismatch_values(array<int, 3>{4, 4, 2}, run_lens));
+        REQUIRE(it.peek().is_none());
+        REQUIRE(details::same_size_hint(it.size_hint(), 0, Some(0)));
+    }
+
+    SECTION("Chain") {
+        const auto tail = vector<int>{6, 7};
+        auto it = iter(int_vec) | chain(iter(tail));
+
+        static_assert(
+            is_same<decltype(it)::Item, const int &>::value,
+            "Item is expected to be of const int & type");
+
+        REQUIRE(it.len() == 8);
+        REQUIRE(details::same_size_hint(it.size_hint(), 8, Some(8)));
+        REQUIRE(&it.next().get_unchecked() == &int_vec[0]);
+        REQUIRE(&it.next_back().get_unchecked() == &tail[1]);
+        REQUIRE(it.len() == 6);
+
+        const auto v_out = move(it) | collect<vector<int>>();
+
+        REQUIRE(details::no_mismatch_values(
+            array<int, 6>{1, 2, 3, 4, 5, 6}, v_out));
+
+        REQUIRE(details::same_size_hint(
+            (range(0, 2) | chain(range(0, 3) | filter([](const int v) {
+                                     return v > 0;
+                                 })))
+                .size_hint(),
+            2,
+            Some(5)));
+    }
+
+    SECTION("ChainFold") {
+        auto it = range(0, 3) | chain(range(10, 3));
+        REQUIRE(it.next().unwrap_unchecked() == 0);
+        REQUIRE((move(it) | fold(0, plus<int>())) == 36);
+
+        auto try_it = range(0, 3) | chain(range(10, 3));
+
+        const auto sum_below_11 = [](const int acc,
+                                     const int v) -> Result<int, int> {
+            if (v > 10) {
+                return Err(v);
+            }
+
+            return Ok(acc + v);
+        };
+
+        const auto res = try_it.try_fold(0, sum_below_11);
+
+        REQUIRE(res.get_err_unchecked() == 11);
+        REQUIRE(try_it.next().unwrap_unchecked() == 12);
+
+        auto empty_it = range(0, 0) | chain(range(5, 1));
+        REQUIRE(empty_it.next().unwrap_unchecked() == 5);
+        REQUIRE(empty_it.next().is_none());
+        REQUIRE(empty_it.len() == 0);
+    }
+
+    SECTION("Fold") {
+        const auto fold_sum = iter(int_vec) | fold(10, plus<int>());
+
+        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 10) == fold_sum);
+    }
+
+    SECTION("FoldConstexpr") {
+        constexpr auto even_square_sum = range(0, 10) | map(Square())
+                                         | filter(IsEven())
+                                         | fold(0, plus<int>());
+
+        static_assert(
+            even_square_sum == 0 + 4 + 16 + 36 + 64,
+            "range | map | filter | fold is expected to be a constant");
+
+        REQUIRE(even_square_sum == 120);
+    }
+
+#if __cpp_constexpr >= 201603L
+    SECTION("FoldConstexprLambda") {
+        constexpr auto skipped_sum = range(0, 10) | skip(2) | take(3)
+                                     | map([](const int value) {
+                                           return value + 1;
+                                       })
+                                     | fold(0, plus<int>());
+
+        static_assert(
+            skipped_sum == 3 + 4 + 5,
+            "adaptors taking lambdas are expected to be constants in C++17");
+
+        REQUIRE(skipped_sum == 12);
+    }
+#endif
+
+    SECTION("ForEach") {
+        int sum = 0;
+
+        iter(int_vec) | for_each([&sum](const auto value) {
+            static_assert(
+                is_same<decltype(value), const int>::value,
+                "value is expected to be of const int type");
+
+            sum += value;
+        });
+
+        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) == sum);
+    }
+
+    SECTION("Map") {
+        double sum = 0.0;
+
+        iter(int_vec) | map([](const auto value) {
+            static_assert(
+                is_same<decltype(value), const int>::value,
+                "value is expected to be of const int type");
+
+            return value * 0.5;
+        }) | for_each([&sum](const auto value) {
+            static_assert(
+                is_same<decltype(value), const double>::value,
+                "value is expected to be of const double type");
+
+            sum += value;
+        });
+
+        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) * 0.5 == sum);
+    }
+
+    SECTION("MaxNone") {
+        const vector<int> VALS;
+        const auto max_opt = iter(VALS) | max();
+        REQUIRE(max_opt.is_none());
+    }
+
+    SECTION("MaxSomeEasy") {
+        const vector<string> VALS{"zzz", "hello", "world"};
+        const auto max_opt = iter(VALS) | max();
+
+        REQUIRE(max_opt.is_some());
+        REQUIRE("zzz" == max_opt.get_unchecked());
+    }
+
+    SECTION("MaxSomeHard") {
+        const vector<int> VALS{-5, 1, 777, 123, 25, 0, 777, 777};
+
+        // hand coded max to get the address eventually
+        REQUIRE(!VALS.empty());
+
+        size_t max_index = 0;
+
+        for (size_t i = 1; i < VALS.size(); ++i) {
+            if (VALS[i] > VALS[max_index]) {
+                max_index = i;
+            }
+        }
+
+        // found the value and referencing it
+        const auto &max_val = VALS[max_index];
+        const auto max_opt = iter(VALS) | max();
+
+        REQUIRE(max_opt.is_some());
+        REQUIRE(777 == max_opt.get_unchecked());
+        REQUIRE(&max_val == &max_opt.get_unchecked());
+    }
+
+    SECTION("MaxByNone") {
+        const vector<int> VALS;
+
+        const auto max_opt =
+            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
+                static_assert(
+                    is_same<decltype(lhs), const int>::value,
+                    "lhs is expected to be of const int type");
+
+                static_assert(
+                    is_same<decltype(rhs), const int>::value,
+                    "rhs is expected to be of const int type");
+
+                return lhs >= rhs;
+            });
+
+        REQUIRE(max_opt.is_none());
+    }
+
+    SECTION("MaxBySomeEasy") {
+        const vector<int> VALS{3, 1, 2};
+
+        const auto max_opt =
+            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
+                static_assert(
+                    is_same<decltype(lhs), const int>::value,
+                    "lhs is expected to be of const int type");
+
+                static_assert(
+                    is_same<decltype(rhs), const int>::value,
+                    "rhs is expected to be of const int type");
+
+                return lhs >= rhs;
+            });
+
+        REQUIRE(max_opt.is_some());
+        REQUIRE(3 == max_opt.get_unchecked());
+    }
+
+    SECTION("MaxBySomeHard") {
+        const vector<int> VALS{5, 2, 7, 3, 3, 2, 2, 9};
+
+        // hand coded max to get the address eventually
+        REQUIRE(!VALS.empty());
+
+        size_t max_index = 0;
+
+        for (size_t i = 1; i < VALS.size(); ++i) {
+            if (VALS[i] > VALS[max_index]) {
+                max_index = i;
+            }
+        }
+
+        // found the value and referencing it
+        const auto &max_val = VALS[max_index];
+
+        const auto max_opt =
+            iter(VALS) | max_by([](const auto lhs, const auto rhs) {
+                static_assert(
+                    is_same<decltype(lhs), const int>::value,
+                    "lhs is expected to be of const int type");
+
+                static_assert(
+                    is_same<decltype(rhs), const int>::value,
+                    "rhs is expected to be of const int type");
+
+                return lhs >= rhs;
+            });
+
+        REQUIRE(max_opt.is_some());
+        REQUIRE(9 == max_opt.get_unchecked());
+        REQUIRE(&max_val == &max_opt.get_unchecked());
+    }
+
+    SECTION("MinNone") {
+        const vector<int> VALS;
+        const auto min_opt = iter(VALS) | min();
+
+        REQUIRE(min_opt.is_none());
+    }
+
+    SECTION("MinSomeEasy") {
+        const vector<string> VALS{"hello", "world", "zzz"};
+        const auto min_opt = iter(VALS) | min();
+
+        REQUIRE(min_opt.is_some());
+        REQUIRE("hello" == min_opt.get_unchecked());
+    }
+
+    SECTION("MinSomeHard") {
+        const vector<int> VALS{-5, 1, -777, 123, 25, 0, -777, -777};
+
+        // hand coded min to get the address eventually
+        REQUIRE(!VALS.empty());
+
+        size_t min_index = 0;
+
+        for (size_t i = 1; i < VALS.size(); ++i) {
+            if (VALS[i] < VALS[min_index]) {
                 min_index = i;
             }
         }
@@ -1136,13 +1908,32 @@ TEST_CASE("Ops section", "[Ops]") {
         const auto &min_val = VALS[min_index];
         const auto min_opt = iter(VALS) | min();
 
-        REQUIRE(min_opt.is_some());
-        REQUIRE(-777 == min_opt.get_unchecked());
-        REQUIRE(&min_val == &min_opt.get_unchecked());
+        REQUIRE(min_opt.is_some());
+        REQUIRE(-777 == min_opt.get_unchecked());
+        REQUIRE(&min_val == &min_opt.get_unchecked());
+    }
+
+    SECTION("MinByNone") {
+        const vector<int> VALS;
+
+        const auto min_opt =
+            iter(VALS) | min_by([](const auto lhs, const auto rhs) {
+                static_assert(
+                    is_same<decltype(lhs), const int>::value,
+                    "lhs is expected to be of const int type");
+
+                static_assert(
+                    is_same<decltype(rhs), const int>::value,
+                    "rhs is expected to be of const int type");
+
+                return lhs <= rhs;
+            });
+
+        REQUIRE(min_opt.is_none());
     }
 
-    SECTION("MinByNone") {
-        const vector<int> VALS;
+    SECTION("MinBySomeEasy") {
+        const vector<int> VALS{1, 3, 2};
 
         const auto min_opt =
             iter(VALS) | min_by([](const auto lhs, const auto rhs) {
@@ -1157,11 +1948,26 @@ TEST_CASE("Ops section", "[Ops]") {
                 return lhs <= rhs;
             });
 
-        REQUIRE(min_opt.is_none());
+        REQUIRE(min_opt.is_some());
+        REQUIRE(1 == min_opt.get_unchecked());
     }
 
-    SECTION("MinBySomeEasy") {
-        const vector<int> VALS{1, 3, 2};
+    SECTION("MinBySomeHard") {
+        const vector<int> VALS{5, 2, 7, 3, 3, 2, 2, 9};
+
+        // hand coded min to get the address eventually
+        REQUIRE(!VALS.empty());
+
+        size_t min_index = 0;
+
+        for (size_t i = 1; i < VALS.size(); ++i) {
+            if (VALS[i] < VALS[min_index]) {
+                min_index = i;
+            }
+        }
+
+        // found the value and referencing it
+        const auto &min_val = VALS[min_index];
 
         const auto min_opt =
             iter(VALS) | min_by([](const auto lhs, const auto rhs) {
@@ -1177,67 +1983,705 @@ TEST_CASE("Ops section", "[Ops]") {
             });
 
         REQUIRE(min_opt.is_some());
-        REQUIRE(1 == min_opt.get_unchecked());
+        REQUIRE(2 == min_opt.get_unchecked());
+        REQUIRE(&min_val == &min_opt.get_unchecked());
+    }
+
+    SECTION("Range") {
+        const auto sum = range(0, 6) | fold(5, plus<int>());
+        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 5) == sum);
+    }
+
+    SECTION("SkipWithin") {
+        const auto sum = iter(int_vec) | skip(3) | fold(0, plus<int>());
+        REQUIRE(12 == sum);
+    }
+
+    SECTION("SkipPass") {
+        const auto sum = iter(int_vec) | skip(100) | fold(0, plus<int>());
+        REQUIRE(0 == sum);
+    }
+
+    SECTION("TakeWithin") {
+        const auto sum = iter(int_vec) | take(3) | fold(0, plus<int>());
+        REQUIRE(3 == sum);
+    }
+
+    SECTION("TakeExceed") {
+        const auto sum = iter(int_vec) | take(100) | fold(0, plus<int>());
+        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) == sum);
+    }
+
+    SECTION("SizeHintSources") {
+        auto it = iter(int_vec);
+        REQUIRE(details::same_size_hint(it.size_hint(), 6, Some(6)));
+
+        it.next();
+        REQUIRE(details::same_size_hint(it.size_hint(), 5, Some(5)));
+
+        const auto int_list = list<int>{0, 1, 2};
+        REQUIRE(details::same_size_hint(iter(int_list).size_hint(), 0, None));
+
+        REQUIRE(details::same_size_hint(
+            iter_begin_end(int_vec.begin(), int_vec.cend()).size_hint(),
+            6,
+            Some(6)));
+
+        REQUIRE(details::same_size_hint(
+            into_iter(vector<int>{0, 1}).size_hint(), 2, Some(2)));
+
+        REQUIRE(details::same_size_hint(range(0, 3).size_hint(), 3, Some(3)));
+        REQUIRE(details::same_size_hint(once(0).size_hint(), 1, Some(1)));
+    }
+
+    SECTION("SizeHintAdaptors") {
+        const auto id = [](const auto &value) { return value; };
+        const auto odd = [](const auto value) { return value % 2 == 1; };
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | map(id)).size_hint(), 6, Some(6)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | filter(odd)).size_hint(), 0, Some(6)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | take(3)).size_hint(), 3, Some(3)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | skip(4)).size_hint(), 2, Some(2)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | skip(100)).size_hint(), 0, Some(0)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | zip(range(0, 4))).size_hint(), 4, Some(4)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | enumerate()).size_hint(), 6, Some(6)));
+
+        REQUIRE(details::same_size_hint(
+            (iter(int_vec) | cloned()).size_hint(), 6, Some(6)));
+
+        REQUIRE(details::same_size_hint(
+            (range(0, 3) | cycle()).size_hint(),
+            std::numeric_limits<size_t>::max(),
+            None));
+
+        REQUIRE(details::same_size_hint(
+            (range(0, 0) | cycle()).size_hint(), 0, Some(0)));
+
+        auto flat_it = range(0, 2) | flat_map([](const auto value) {
+                           return vector<int>(3, value);
+                       });
+
+        REQUIRE(details::same_size_hint(flat_it.size_hint(), 0, None));
+
+        flat_it.next();
+        REQUIRE(details::same_size_hint(flat_it.size_hint(), 2, None));
+
+        flat_it.next();
+        flat_it.next();
+        flat_it.next();
+        REQUIRE(details::same_size_hint(flat_it.size_hint(), 2, Some(2)));
+    }
+
+    SECTION("LenSources") {
+        auto it = iter(int_vec);
+        REQUIRE(6 == it.len());
+
+        it.next();
+        REQUIRE(5 == it.len());
+
+        auto v = int_vec;
+        REQUIRE(6 == iter_mut(v).len());
+        REQUIRE(2 == into_iter(vector<int>{0, 1}).len());
+        REQUIRE(6 == iter_begin_end(int_vec.begin(), int_vec.cend()).len());
+        REQUIRE(3 == range(0, 3).len());
+        REQUIRE(1 == once(0).len());
+
+        static_assert(
+            !rustfp::details::is_exact_size<decltype(
+                iter(std::declval<const list<int> &>()))>::value,
+            "Iter over list is expected to be not exact size");
+    }
+
+    SECTION("LenAdaptors") {
+        const auto id = [](const auto &value) { return value; };
+        const auto odd = [](const auto value) { return value % 2 == 1; };
+
+        REQUIRE(6 == (iter(int_vec) | map(id)).len());
+        REQUIRE(6 == (iter(int_vec) | enumerate()).len());
+        REQUIRE(6 == (iter(int_vec) | cloned()).len());
+        REQUIRE(3 == (iter(int_vec) | take(3)).len());
+        REQUIRE(6 == (iter(int_vec) | take(100)).len());
+        REQUIRE(2 == (iter(int_vec) | skip(4)).len());
+        REQUIRE(0 == (iter(int_vec) | skip(100)).len());
+        REQUIRE(4 == (iter(int_vec) | zip(range(0, 4))).len());
+
+        REQUIRE(
+            2
+            == (iter(int_vec) | skip(1) | map(id) | zip(range(0, 10)) | take(2))
+                   .len());
+
+        static_assert(
+            !rustfp::details::is_exact_size<decltype(
+                iter(int_vec) | filter(odd))>::value,
+            "Filter is expected to be not exact size");
+
+        static_assert(
+            !rustfp::details::is_exact_size<decltype(
+                iter(int_vec) | zip(iter(int_vec) | filter(odd)))>::value,
+            "Zip with Filter is expected to be not exact size");
+    }
+
+    SECTION("CollectVecReserve") {
+        const auto v = range(0, 100) | collect<vector<int>>();
+
+        REQUIRE(100 == v.size());
+        REQUIRE(100 == v.capacity());
+    }
+
+    SECTION("CollectResultVecReserve") {
+        const auto res = range(0, 100) | map([](const auto value) {
+                             return Result<int, string>(Ok(value));
+                         })
+                         | collect<Result<vector<int>, string>>();
+
+        REQUIRE(res.is_ok());
+        REQUIRE(100 == res.get_unchecked().size());
+        REQUIRE(100 == res.get_unchecked().capacity());
+    }
+
+    SECTION("FoldSources") {
+        const auto int_list = list<int>{0, 1, 2, 3, 4, 5};
+
+        REQUIRE(15 == iter(int_vec).fold(0, plus<int>()));
+        REQUIRE(15 == iter(int_list).fold(0, plus<int>()));
+        REQUIRE(15 == into_iter(vector<int>(int_vec)).fold(0, plus<int>()));
+        REQUIRE(15 == range(0, 6).fold(0, plus<int>()));
+
+        auto v = int_vec;
+
+        iter_mut(v).fold(Unit, [](const auto, auto &value) {
+            value *= 2;
+            return Unit;
+        });
+
+        REQUIRE(30 == accumulate(cbegin(v), cend(v), 0));
+
+        auto it = iter(int_vec);
+        it.fold(0, plus<int>());
+        REQUIRE(it.next().is_none());
+    }
+
+    SECTION("FoldAdaptors") {
+        const auto add_one = [](const auto value) { return value + 1; };
+        const auto odd = [](const auto value) { return value % 2 == 1; };
+
+        REQUIRE(21 == (iter(int_vec) | map(add_one)).fold(0, plus<int>()));
+        REQUIRE(9 == (iter(int_vec) | filter(odd)).fold(0, plus<int>()));
+        REQUIRE(15 == (iter(int_vec) | cloned()).fold(0, plus<int>()));
+        REQUIRE(3 == (iter(int_vec) | take(3)).fold(0, plus<int>()));
+        REQUIRE(0 == (iter(int_vec) | take(0)).fold(0, plus<int>()));
+        REQUIRE(9 == (iter(int_vec) | skip(4)).fold(0, plus<int>()));
+
+        const auto filter_map_sum =
+            (iter(int_vec) | filter_map([](const auto value) {
+                 return opt_if(value % 2 == 0, [value] { return value; });
+             }))
+                .fold(0, plus<int>());
+
+        REQUIRE(6 == filter_map_sum);
+
+        const auto enumerate_sum =
+            (iter(int_vec) | enumerate())
+                .fold(0, [](const auto acc, const auto &index_value) {
+                    return acc + static_cast<int>(index_value.first)
+                           + index_value.second;
+                });
+
+        REQUIRE(30 == enumerate_sum);
+
+        const auto zip_sum =
+            (iter(int_vec) | zip(range(10, 3)))
+                .fold(0, [](const auto acc, const auto &value_pair) {
+                    return acc + value_pair.first * value_pair.second;
+                });
+
+        REQUIRE(35 == zip_sum);
+
+        auto flat_it = range(0, 3) | flat_map([](const auto value) {
+                           return vector<int>(2, value);
+                       });
+
+        // the front sub-iterator is only partially consumed
+        REQUIRE(flat_it.next().is_some());
+        REQUIRE(6 == flat_it.fold(0, plus<int>()));
+        REQUIRE(flat_it.next().is_none());
+    }
+
+    SECTION("TryFoldEarlyStop") {
+        const auto sum_below_3 = [](const int acc, const int value) {
+            return res_if_else(
+                value < 3,
+                [acc, value] { return acc + value; },
+                [value] { return value; });
+        };
+
+        auto it = iter(int_vec);
+        const auto res = it.try_fold(0, sum_below_3);
+
+        REQUIRE(res.is_err());
+        REQUIRE(3 == res.get_err_unchecked());
+        REQUIRE(4 == it.next().get_unchecked());
+
+        const auto int_list = list<int>{0, 1, 2, 3, 4, 5};
+        auto list_it = iter(int_list);
+        REQUIRE(list_it.try_fold(0, sum_below_3).is_err());
+        REQUIRE(4 == list_it.next().get_unchecked());
+
+        auto range_it = range(0, 6);
+        REQUIRE(range_it.try_fold(0, sum_below_3).is_err());
+        REQUIRE(4 == range_it.next().get_unchecked());
+
+        auto map_it =
+            iter(int_vec) | map([](const auto value) { return value; });
+        REQUIRE(map_it.try_fold(0, sum_below_3).is_err());
+        REQUIRE(4 == map_it.next().get_unchecked());
+
+        const auto ok_res = (iter(int_vec) | take(3)).try_fold(0, sum_below_3);
+        REQUIRE(ok_res.is_ok());
+        REQUIRE(3 == ok_res.get_unchecked());
+    }
+
+    SECTION("TryFoldTakeResume") {
+        const auto sum = [](const int acc, const int value) {
+            return Result<int, int>(Ok(acc + value));
+        };
+
+        auto it = iter(int_vec) | take(4);
+        const auto res = it.try_fold(0, sum);
+
+        REQUIRE(res.is_ok());
+        REQUIRE(6 == res.get_unchecked());
+        REQUIRE(it.next().is_none());
+    }
+
+    SECTION("TryFoldZipShorter") {
+        const auto sum = [](const int acc, const auto &value_pair) {
+            return Result<int, int>(Ok(acc + value_pair.second));
+        };
+
+        auto it = range(0, 10) | zip(iter(int_vec));
+        const auto res = it.try_fold(0, sum);
+
+        REQUIRE(res.is_ok());
+        REQUIRE(15 == res.get_unchecked());
+    }
+
+    SECTION("TryFoldFlatMapResume") {
+        const auto sum_below_2 = [](const int acc, const int value) {
+            return res_if_else(
+                value < 2,
+                [acc, value] { return acc + value; },
+                [value] { return value; });
+        };
+
+        auto it = range(0, 4) | flat_map([](const auto value) {
+                      return vector<int>(2, value);
+                  });
+
+        const auto res = it.try_fold(0, sum_below_2);
+
+        REQUIRE(res.is_err());
+        REQUIRE(2 == res.get_err_unchecked());
+
+        // the rest of the sub-iterator must be kept
+        REQUIRE(2 == it.next().get_unchecked());
+        REQUIRE(3 == it.next().get_unchecked());
+        REQUIRE(3 == it.next().get_unchecked());
+        REQUIRE(it.next().is_none());
+    }
+
+    SECTION("NthWithin") {
+        const auto opt = iter(int_vec) | nth(2);
+
+        REQUIRE(opt.is_some());
+        REQUIRE(2 == opt.get_unchecked());
+    }
+
+    SECTION("NthExceed") {
+        const auto opt = iter(int_vec) | nth(6);
+        REQUIRE(opt.is_none());
+    }
+
+    SECTION("AdvanceBySources") {
+        auto it = iter(int_vec);
+        REQUIRE(it.advance_by(2).is_ok());
+        REQUIRE(2 == it.next().get_unchecked());
+
+        const auto it_res = it.advance_by(10);
+        REQUIRE(it_res.is_err());
+        REQUIRE(7 == it_res.get_err_unchecked());
+        REQUIRE(it.next().is_none());
+
+        const auto int_list = list<int>{0, 1, 2, 3};
+        auto list_it = iter(int_list);
+        REQUIRE(list_it.advance_by(3).is_ok());
+        REQUIRE(3 == list_it.next().get_unchecked());
+        REQUIRE(1 == list_it.advance_by(1).get_err_unchecked());
+
+        auto v = int_vec;
+        auto mut_it = iter_mut(v);
+        REQUIRE(mut_it.advance_by(5).is_ok());
+        mut_it.next().get_mut_unchecked() = 10;
+        REQUIRE(10 == v[5]);
+
+        auto into_it = into_iter(vector<int>{0, 1, 2});
+        REQUIRE(into_it.advance_by(1).is_ok());
+        REQUIRE(1 == into_it.next().get_unchecked());
+
+        auto begin_end_it = iter_begin_end(int_vec.cbegin(), int_vec.cend());
+        REQUIRE(begin_end_it.advance_by(4).is_ok());
+        REQUIRE(4 == begin_end_it.next().get_unchecked());
+
+        auto range_it = range(10, 5);
+        REQUIRE(range_it.advance_by(3).is_ok());
+        REQUIRE(13 == range_it.next().get_unchecked());
+        REQUIRE(2 == range_it.advance_by(3).get_err_unchecked());
+        REQUIRE(range_it.next().is_none());
+    }
+
+    SECTION("AdvanceByAdaptors") {
+        auto call_count = 0;
+
+        auto map_it = iter(int_vec) | map([&call_count](const auto value) {
+                          ++call_count;
+                          return value * 2;
+                      });
+
+        REQUIRE(map_it.advance_by(4).is_ok());
+        REQUIRE(8 == map_it.next().get_unchecked());
+        REQUIRE(1 == call_count);
+
+        auto enumerate_it = iter(int_vec) | enumerate();
+        REQUIRE(enumerate_it.advance_by(3).is_ok());
+
+        const auto index_value = enumerate_it.next().get_unchecked();
+        REQUIRE(3 == index_value.first);
+        REQUIRE(3 == index_value.second);
+
+        auto cloned_it = iter(int_vec) | cloned();
+        REQUIRE(cloned_it.advance_by(5).is_ok());
+        REQUIRE(5 == cloned_it.next().get_unchecked());
+        REQUIRE(1 == cloned_it.advance_by(1).get_err_unchecked());
+    }
+
+    SECTION("SkipAdvanceBy") {
+        auto call_count = 0;
+
+        const auto v = iter(int_vec) | map([&call_count](const auto value) {
+                           ++call_count;
+                           return value;
+                       })
+                       | skip(3) | take(2) | collect<vector<int>>();
+
+        REQUIRE((vector<int>{3, 4}) == v);
+        REQUIRE(2 == call_count);
+
+        auto skip_it = range(0, 10) | skip(2);
+        REQUIRE(skip_it.advance_by(3).is_ok());
+        REQUIRE(5 == skip_it.next().get_unchecked());
+
+        auto skip_exceed_it = range(0, 3) | skip(5);
+        REQUIRE(2 == skip_exceed_it.advance_by(2).get_err_unchecked());
+    }
+
+    SECTION("NextBackSources") {
+        auto it = iter(int_vec);
+        REQUIRE(5 == it.next_back().get_unchecked());
+        REQUIRE(0 == it.next().get_unchecked());
+        REQUIRE(it.advance_back_by(2).is_ok());
+        REQUIRE(2 == it.next_back().get_unchecked());
+        REQUIRE(1 == it.next_back().get_unchecked());
+        REQUIRE(it.next_back().is_none());
+        REQUIRE(it.next().is_none());
+
+        const auto int_list = list<int>{0, 1, 2};
+        auto list_it = iter(int_list);
+        REQUIRE(2 == list_it.next_back().get_unchecked());
+        REQUIRE(1 == list_it.advance_back_by(3).get_err_unchecked());
+
+        auto v = int_vec;
+        auto mut_it = iter_mut(v);
+        mut_it.next_back().get_mut_unchecked() = 10;
+        REQUIRE(10 == v[5]);
+
+        auto into_it = into_iter(vector<int>{0, 1, 2});
+        REQUIRE(2 == into_it.next_back().get_unchecked());
+        REQUIRE(0 == into_it.next().get_unchecked());
+
+        auto begin_end_it = iter_begin_end(int_vec.cbegin(), int_vec.cend());
+        REQUIRE(5 == begin_end_it.next_back().get_unchecked());
+
+        auto range_it = range(10, 5);
+        REQUIRE(14 == range_it.next_back().get_unchecked());
+        REQUIRE(range_it.advance_back_by(2).is_ok());
+        REQUIRE(11 == range_it.next_back().get_unchecked());
+        REQUIRE(10 == range_it.next().get_unchecked());
+        REQUIRE(range_it.next_back().is_none());
+
+        static_assert(
+            !rustfp::details::is_double_ended<decltype(
+                iter(std::declval<const forward_list<int> &>()))>::value,
+            "Iter over forward_list is expected to be not double-ended");
+    }
+
+    SECTION("NextBackAdaptors") {
+        const auto add_one = [](const auto value) { return value + 1; };
+        const auto odd = [](const auto value) { return value % 2 == 1; };
+
+        REQUIRE(
+            6 == (iter(int_vec) | map(add_one)).next_back().get_unchecked());
+        REQUIRE(5 == (iter(int_vec) | filter(odd)).next_back().get_unchecked());
+        REQUIRE(5 == (iter(int_vec) | cloned()).next_back().get_unchecked());
+        REQUIRE(2 == (iter(int_vec) | take(3)).next_back().get_unchecked());
+        REQUIRE(5 == (iter(int_vec) | take(100)).next_back().get_unchecked());
+        REQUIRE(5 == (iter(int_vec) | skip(4)).next_back().get_unchecked());
+        REQUIRE((iter(int_vec) | skip(100)).next_back().is_none());
+
+        const auto index_value =
+            (iter(int_vec) | enumerate()).next_back().get_unchecked();
+
+        REQUIRE(5 == index_value.first);
+        REQUIRE(5 == index_value.second);
+
+        auto zip_it = iter(int_vec) | zip(range(10, 3));
+        const auto value_pair = zip_it.next_back().get_unchecked();
+        REQUIRE(2 == value_pair.first);
+        REQUIRE(12 == value_pair.second);
+        REQUIRE(0 == zip_it.next().get_unchecked().first);
+        REQUIRE(1 == zip_it.next_back().get_unchecked().first);
+        REQUIRE(zip_it.next().is_none());
+
+        static_assert(
+            !rustfp::details::is_double_ended<decltype(
+                iter(int_vec) | filter(odd) | enumerate())>::value,
+            "Enumerate over Filter is expected to be not double-ended");
+    }
+
+    SECTION("RevCollect") {
+        const auto v = iter(int_vec) | rev() | collect<vector<int>>();
+        REQUIRE((vector<int>{5, 4, 3, 2, 1, 0}) == v);
+    }
+
+    SECTION("RevLastMatches") {
+        const auto v = iter(int_vec)
+                       | filter([](const auto value) { return value % 2 == 0; })
+                       | rev() | take(2) | collect<vector<int>>();
+
+        REQUIRE((vector<int>{4, 2}) == v);
+    }
+
+    SECTION("RevEnumerateTake") {
+        const auto v = iter(int_vec) | enumerate() | take(4) | rev()
+                       | map([](const auto &index_value) {
+                             return index_value.first;
+                         })
+                       | collect<vector<size_t>>();
+
+        REQUIRE((vector<size_t>{3, 2, 1, 0}) == v);
+    }
+
+    SECTION("RevRev") {
+        auto it = range(0, 4) | rev() | skip(1) | rev();
+
+        REQUIRE(0 == it.next().get_unchecked());
+        REQUIRE(2 == it.next_back().get_unchecked());
+        REQUIRE(1 == it.len());
+        REQUIRE(1 == (move(it) | nth(0)).get_unchecked());
+    }
+
+    SECTION("ZipNextShortCircuit") {
+        size_t pulled = 0;
+
+        auto other = range(0, 5) | map([&pulled](const int value) {
+                         ++pulled;
+                         return value;
+                     });
+
+        auto it = range(0, 2) | zip(move(other));
+
+        REQUIRE(it.next().is_some());
+        REQUIRE(it.next().is_some());
+        REQUIRE(it.next().is_none());
+        REQUIRE(2 == pulled);
+    }
+
+    SECTION("ZipTrustedRandomAccess") {
+        const auto lhs = vector<int>{1, 2, 3, 4};
+        const auto rhs = vector<int>{5, 6, 7};
+
+        using RefZip = decltype(iter(lhs) | zip(iter(rhs)));
+        using ListZip = decltype(iter(lhs) | zip(iter(list<int>{})));
+
+        static_assert(
+            rustfp::details::is_trusted_random_access<RefZip>::value,
+            "Zip of vector Iter is expected to be trusted random access");
+
+        static_assert(
+            !rustfp::details::is_trusted_random_access<ListZip>::value,
+            "Zip of list Iter is not expected to be trusted random access");
+
+        size_t mapped = 0;
+
+        const auto dot = iter(lhs) | map([&mapped](const int value) {
+                             ++mapped;
+                             return value;
+                         })
+                         | zip(iter(rhs))
+                         | map([](const auto &p) { return p.first * p.second; })
+                         | fold(0, [](const int acc, const int value) {
+                               return acc + value;
+                           });
+
+        REQUIRE(38 == dot);
+        REQUIRE(3 == mapped);
+
+        const auto index_sum = iter(lhs) | enumerate() | zip(range(10, 3))
+                               | fold(size_t(0), [](const size_t acc, auto p) {
+                                     return acc + p.first.first + p.second;
+                                 });
+
+        REQUIRE(36 == index_sum);
+    }
+
+    SECTION("ZipTrustedRandomAccessTryFoldResume") {
+        const auto stop_at_2 = [](const int acc, const auto &p) {
+            return res_if_else(
+                p.first < 2,
+                [acc, &p] { return acc + p.second; },
+                [&p] { return p.first; });
+        };
+
+        auto it = range(0, 5) | zip(iter(int_vec));
+        const auto res = it.try_fold(0, stop_at_2);
+
+        REQUIRE(res.is_err());
+        REQUIRE(2 == res.get_err_unchecked());
+
+        const auto next_opt = it.next();
+        REQUIRE(next_opt.is_some());
+        REQUIRE(3 == next_opt.get_unchecked().first);
+        REQUIRE(3 == next_opt.get_unchecked().second);
+        REQUIRE(1 == it.len());
+    }
+
+    SECTION("ContiguousIterSelected") {
+        auto v = vector<int>{0, 1, 2};
+        auto arr = array<int, 3>{{0, 1, 2}};
+        auto str = string("abc");
+        int c_arr[] = {0, 1, 2};
+        const auto bool_vec = vector<bool>{true};
+        const auto int_list = list<int>{0, 1, 2};
+
+        static_assert(
+            is_same<decltype(iter(v)), ContiguousIter<const int>>::value,
+            "iter(vector) is expected to be of ContiguousIter type");
+
+        static_assert(
+            is_same<decltype(iter_mut(arr)), ContiguousIter<int>>::value,
+            "iter_mut(array) is expected to be of ContiguousIter type");
+
+        static_assert(
+            is_same<decltype(iter(c_arr)), ContiguousIter<const int>>::value,
+            "iter(C array) is expected to be of ContiguousIter type");
+
+        static_assert(
+            is_same<
+                decltype(iter_begin_end(v.data(), v.data() + v.size())),
+                ContiguousIter<const int>>::value,
+            "iter_begin_end(pointers) is expected to be of ContiguousIter "
+            "type");
+
+        static_assert(
+            is_same<decltype(iter(bool_vec)), Iter<const vector<bool>>>::value,
+            "iter(vector<bool>) is not expected to be of ContiguousIter type");
+
+        static_assert(
+            is_same<decltype(iter(int_list)), Iter<const list<int>>>::value,
+            "iter(list) is not expected to be of ContiguousIter type");
+
+        static_assert(
+            sizeof(ContiguousIter<const int>) == 2 * sizeof(const int *),
+            "ContiguousIter is expected to only hold a pair of pointers");
+
+        REQUIRE(3 == (iter(c_arr) | fold(0, plus<int>())));
+
+        iter_mut(str) | for_each([](char &c) { c = 'x'; });
+        REQUIRE("xxx" == str);
+
+        auto it = iter(v);
+        REQUIRE(v.data() == it.as_ptr());
+        REQUIRE(2 == it.next_back().get_unchecked());
+        REQUIRE(it.advance_by(1).is_ok());
+        REQUIRE(v.data() + 1 == it.as_ptr());
+        REQUIRE(1 == it.len());
     }
 
-    SECTION("MinBySomeHard") {
-        const vector<int> VALS{5, 2, 7, 3, 3, 2, 2, 9};
+    SECTION("StdIterRangeFor") {
+        auto pipeline = iter(int_vec) | filter([](const auto value) {
+                            return value % 2 == 1;
+                        });
 
-        // hand coded min to get the address eventually
-        REQUIRE(!VALS.empty());
+        vector<const int *> ptrs;
 
-        size_t min_index = 0;
+        for (const auto &value : pipeline) {
+            ptrs.push_back(&value);
+        }
 
-        for (size_t i = 1; i < VALS.size(); ++i) {
-            if (VALS[i] < VALS[min_index]) {
-                min_index = i;
-            }
+        REQUIRE(3 == ptrs.size());
+        REQUIRE(&int_vec[1] == ptrs[0]);
+        REQUIRE(&int_vec[5] == ptrs[2]);
+
+        vector<unique_ptr<int>> moved;
+
+        for (auto &&ptr : into_iter(vector<unique_ptr<int>>(2))) {
+            moved.push_back(move(ptr));
         }
 
-        // found the value and referencing it
-        const auto &min_val = VALS[min_index];
+        REQUIRE(2 == moved.size());
+    }
 
-        const auto min_opt =
-            iter(VALS) | min_by([](const auto lhs, const auto rhs) {
-                static_assert(
-                    is_same<decltype(lhs), const int>::value,
-                    "lhs is expected to be of const int type");
+    SECTION("StdIterAlgorithms") {
+        auto squares =
+            range(1, 3) | map([](const int value) { return value * value; });
 
-                static_assert(
-                    is_same<decltype(rhs), const int>::value,
-                    "rhs is expected to be of const int type");
+        REQUIRE(14 == accumulate(begin(squares), end(squares), 0));
 
-                return lhs <= rhs;
-            });
+        auto strs = iter(int_vec) | skip(4)
+                    | map([](const int value) { return to_string(value); });
 
-        REQUIRE(min_opt.is_some());
-        REQUIRE(2 == min_opt.get_unchecked());
-        REQUIRE(&min_val == &min_opt.get_unchecked());
-    }
+        vector<string> out;
+        std::copy(begin(strs), end(strs), std::back_inserter(out));
 
-    SECTION("Range") {
-        const auto sum = range(0, 6) | fold(5, plus<int>());
-        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 5) == sum);
-    }
+        REQUIRE((vector<string>{"4", "5"}) == out);
 
-    SECTION("SkipWithin") {
-        const auto sum = iter(int_vec) | skip(3) | fold(0, plus<int>());
-        REQUIRE(12 == sum);
+        auto empty = range(0, 0);
+        REQUIRE(begin(empty) == end(empty));
     }
 
-    SECTION("SkipPass") {
-        const auto sum = iter(int_vec) | skip(100) | fold(0, plus<int>());
-        REQUIRE(0 == sum);
-    }
+    SECTION("AnyStopsEarly") {
+        auto count = 0;
 
-    SECTION("TakeWithin") {
-        const auto sum = iter(int_vec) | take(3) | fold(0, plus<int>());
-        REQUIRE(3 == sum);
-    }
+        const auto found = iter(int_vec) | map([&count](const auto value) {
+                               ++count;
+                               return value;
+                           })
+                           | any([](const auto value) { return value == 2; });
 
-    SECTION("TakeExceed") {
-        const auto sum = iter(int_vec) | take(100) | fold(0, plus<int>());
-        REQUIRE(accumulate(cbegin(int_vec), cend(int_vec), 0) == sum);
+        REQUIRE(found);
+        REQUIRE(3 == count);
     }
 }
 
@@ -1445,8 +2889,9 @@ TEST_CASE("Option methods", "[Option]") {
         Option<int> opt_rhs(Some(7));
         const Option<int> opt(move(opt_rhs));
 
+        // trivially copyable item is left unchanged in the moved-from Option
         REQUIRE(opt.is_some());
-        REQUIRE(opt_rhs.is_none());
+        REQUIRE(opt_rhs.is_some());
         REQUIRE(7 == opt.get_unchecked());
     }
 
@@ -1509,11 +2954,22 @@ TEST_CASE("Option methods", "[Option]") {
         auto opt_rhs = Some(7);
         opt = move(opt_rhs);
 
+        // trivially copyable item is left unchanged in the moved-from Option
         REQUIRE(opt.is_some());
-        REQUIRE(opt_rhs.is_none());
+        REQUIRE(opt_rhs.is_some());
         REQUIRE(7 == opt.get_unchecked());
     }
 
+    SECTION("MoveAssignComplex") {
+        Option<unique_ptr<int>> opt = None;
+        auto opt_rhs = Some(make_unique<int>(7));
+        opt = move(opt_rhs);
+
+        REQUIRE(opt.is_some());
+        REQUIRE(opt_rhs.is_none());
+        REQUIRE(7 == *opt.get_unchecked());
+    }
+
     SECTION("MoveAssignConvert") {
         Option<string> opt = None;
         auto opt_rhs = Some("Hello");
@@ -1533,6 +2989,141 @@ TEST_CASE("Option methods", "[Option]") {
         REQUIRE(opt.is_none());
     }
 
+    SECTION("RefPointerSized") {
+        static_assert(
+            sizeof(Option<const int &>) == sizeof(const int *),
+            "Option<const int &> is expected to be pointer sized");
+
+        static_assert(
+            std::is_trivially_copyable<Option<string &>>::value,
+            "Option<string &> is expected to be trivially copyable");
+
+        const int value = 7;
+        auto opt = Some(cref(value));
+        const auto opt_copy = opt;
+
+        REQUIRE(&value == &opt_copy.get_unchecked());
+
+        opt = None;
+        REQUIRE(opt.is_none());
+        REQUIRE(opt_copy.is_some());
+    }
+
+    SECTION("TriviallyCopyable") {
+        static_assert(
+            std::is_trivially_copyable<Option<int>>::value,
+            "Option<int> is expected to be trivially copyable");
+
+        static_assert(
+            std::is_trivially_destructible<Option<double>>::value,
+            "Option<double> is expected to be trivially destructible");
+
+        static_assert(
+            std::is_trivially_copyable<Option<SlotIndex>>::value,
+            "Option<SlotIndex> is expected to be trivially copyable");
+
+        static_assert(
+            !std::is_trivially_copyable<Option<string>>::value,
+            "Option<string> is expected to be non-trivially copyable");
+
+        const auto opt_rhs = Some(7);
+        Option<int> opt = None;
+        std::memcpy(&opt, &opt_rhs, sizeof(opt));
+
+        REQUIRE(opt.is_some());
+        REQUIRE(7 == opt.get_unchecked());
+    }
+
+    SECTION("Constexpr") {
+        constexpr auto squared = Some(3).map(Square()).unwrap_or(0);
+        constexpr auto none_or = Option<int>(None).unwrap_or(7);
+        constexpr auto refilled = take_then_refill(5);
+
+        constexpr auto slot =
+            Option<SlotIndex>(Some(static_cast<SlotIndex>(3))).is_some();
+
+        static_assert(squared == 9, "Some(3).map() is expected to be 9");
+        static_assert(none_or == 7, "None.unwrap_or(7) is expected to be 7");
+        static_assert(refilled == 15, "take then refill is expected to be 15");
+        static_assert(slot, "niche Option is expected to be a constant");
+
+        REQUIRE(9 == squared);
+        REQUIRE(7 == none_or);
+        REQUIRE(15 == refilled);
+    }
+
+    SECTION("MoveCtorRef") {
+        const int value = 7;
+        auto opt_rhs = Some(cref(value));
+        const Option<const int &> opt(move(opt_rhs));
+
+        REQUIRE(opt.is_some());
+        REQUIRE(&value == &opt.get_unchecked());
+    }
+
+    SECTION("NicheSized") {
+        static_assert(
+            sizeof(Option<SlotIndex>) == sizeof(SlotIndex),
+            "Option<SlotIndex> is expected to have the same size as SlotIndex");
+
+        static_assert(
+            sizeof(Option<Meters>) == sizeof(Meters),
+            "Option<Meters> is expected to have the same size as Meters");
+
+        Option<SlotIndex> opt = None;
+        REQUIRE(opt.is_none());
+
+        opt = Some(static_cast<SlotIndex>(3));
+        REQUIRE(opt.is_some());
+        REQUIRE(static_cast<SlotIndex>(3) == opt.get_unchecked());
+
+        const auto opt_moved = move(opt);
+        REQUIRE(opt_moved.is_some());
+
+        const auto meters = Option<Meters>(Some(Meters{1.5}))
+                                .map([](const Meters m) { return m.value; })
+                                .unwrap_or(0.0);
+
+        REQUIRE(1.5 == meters);
+        REQUIRE(Option<Meters>(None).is_none());
+    }
+
+#if !defined(NDEBUG) && defined(__unix__)
+    SECTION("NicheSentinelAsserts") {
+        // the sentinel given as Some would otherwise be silently read as None
+        const auto sentinel = static_cast<SlotIndex>(UINT32_MAX);
+        const auto index = static_cast<SlotIndex>(3);
+
+        REQUIRE(details::aborts([sentinel] {
+            return Option<SlotIndex>(Some(sentinel));
+        }));
+
+        REQUIRE(details::aborts([sentinel] {
+            auto opt = Option<SlotIndex>(None);
+            opt = Some(sentinel);
+            return opt;
+        }));
+
+        REQUIRE(details::aborts([] {
+            return Option<Meters>(
+                Some(Meters{std::numeric_limits<double>::quiet_NaN()}));
+        }));
+
+        // Result with unit Err reuses the same storage for Ok
+        REQUIRE(details::aborts([sentinel] {
+            return Result<SlotIndex, unit_t>(Ok(sentinel));
+        }));
+
+        REQUIRE_FALSE(details::aborts([index] {
+            return Option<SlotIndex>(Some(index));
+        }));
+
+        REQUIRE_FALSE(details::aborts([index] {
+            return Result<SlotIndex, unit_t>(Ok(index));
+        }));
+    }
+#endif
+
     SECTION("GetUncheckedRef") {
         const string value = "Hello";
         auto opt = Some(cref(value));
@@ -2007,6 +3598,19 @@ TEST_CASE("Option methods", "[Option]") {
         REQUIRE(opt.is_none());
     }
 
+    SECTION("MapSomeInPlace") {
+        size_t copy_moves = 0;
+
+        const auto opt = Some(7).map([&copy_moves](const int value) {
+            return Tracked(copy_moves, value);
+        });
+
+        // only the single emplace into nonstd::optional moves the result
+        REQUIRE(opt.is_some());
+        REQUIRE(7 == opt.get_unchecked().get());
+        REQUIRE(1 == copy_moves);
+    }
+
     SECTION("MapOrSome") {
         auto opt = Some(0);
 
@@ -2322,6 +3926,45 @@ TEST_CASE("Option methods", "[Option]") {
         REQUIRE(8 == opt.get_unchecked());
     }
 
+    SECTION("Emplace") {
+        size_t copy_moves = 0;
+        Option<Tracked> opt = None;
+
+        const auto &value = opt.emplace(copy_moves, 7);
+        REQUIRE(opt.is_some());
+        REQUIRE(7 == value.get());
+
+        opt.emplace(copy_moves, 8);
+        REQUIRE(8 == opt.get_unchecked().get());
+        REQUIRE(0 == copy_moves);
+
+        Option<Pinned> pinned(None);
+        pinned.emplace(9);
+
+        REQUIRE(pinned.is_some());
+        REQUIRE(9 == pinned.get_unchecked().get());
+    }
+
+    SECTION("MakeSome") {
+        size_t copy_moves = 0;
+        const auto opt = make_some<Tracked>(copy_moves, 7);
+
+        REQUIRE(opt.is_some());
+        REQUIRE(7 == opt.get_unchecked().get());
+        REQUIRE(0 == copy_moves);
+
+        const auto str_opt = make_some<string>(3, 'x');
+        REQUIRE("xxx" == str_opt.get_unchecked());
+
+        const auto slot_opt = make_some<SlotIndex>(SlotIndex{});
+        REQUIRE(slot_opt.is_some());
+
+#ifdef __cpp_guaranteed_copy_elision
+        const auto pinned = make_some<Pinned>(9);
+        REQUIRE(9 == pinned.get_unchecked().get());
+#endif
+    }
+
     SECTION("TakeSome") {
         auto opt = Some(make_unique<int>(7));
         const auto optb = opt.take();
@@ -2400,6 +4043,85 @@ TEST_CASE("Result methods", "[Result]") {
         REQUIRE(7 == *res.get_unchecked());
     }
 
+    SECTION("TriviallyCopyable") {
+        static_assert(
+            std::is_trivially_copyable<Result<int, int>>::value,
+            "Result<int, int> is expected to be trivially copyable");
+
+        static_assert(
+            std::is_trivially_destructible<Result<double, unit_t>>::value,
+            "Result<double, unit_t> is expected to be trivially destructible");
+
+        static_assert(
+            !std::is_trivially_copyable<Result<int, string>>::value,
+            "Result<int, string> is expected to be non-trivially copyable");
+
+        const Result<int, int> res_rhs = Err(7);
+        Result<int, int> res = Ok(0);
+        std::memcpy(&res, &res_rhs, sizeof(res));
+
+        REQUIRE(res.is_err());
+        REQUIRE(7 == res.get_err_unchecked());
+    }
+
+    SECTION("Constexpr") {
+        constexpr auto mapped =
+            Result<int, int>(Ok(3)).map(Square()).unwrap_or(0);
+
+        constexpr auto flipped = flip_to_err(3);
+
+        static_assert(mapped == 9, "Ok(3).map() is expected to be 9");
+
+        static_assert(
+            flipped.is_err() && flipped.get_err_unchecked() == 4,
+            "assigning Err over Ok is expected to be a constant");
+
+        REQUIRE(9 == mapped);
+        REQUIRE(flipped.is_err());
+        REQUIRE(4 == flipped.get_err_unchecked());
+    }
+
+    SECTION("LazyError") {
+        size_t format_count = 0;
+
+        const auto make_err = [&format_count](const int value) {
+            return Result<int, LazyError>(
+                Err(LazyError("invalid", [&format_count, value] {
+                    ++format_count;
+                    return "invalid value: " + to_string(value);
+                })));
+        };
+
+        REQUIRE(7 == make_err(1).unwrap_or(7));
+        REQUIRE(make_err(2).ok().is_none());
+        REQUIRE(0 == format_count);
+
+        const auto err = make_err(3).unwrap_err_unchecked();
+        auto err_copy = err;
+        const auto err_moved = move(err_copy);
+        REQUIRE(0 == format_count);
+
+        REQUIRE(string("invalid") == err_moved.code());
+        REQUIRE("invalid value: 3" == err.message());
+        REQUIRE("invalid value: 3" == err_moved.message());
+        REQUIRE(2 == format_count);
+
+        err_copy = LazyError("plain");
+        REQUIRE("plain" == err_copy.message());
+        REQUIRE(2 == format_count);
+    }
+
+    SECTION("LazyErrorOutlivesCreator") {
+        const auto err = parse_digit('x').unwrap_err_unchecked();
+
+        // reuses the stack frame that created the error
+        REQUIRE(7 == parse_digit('7').get_unchecked());
+        REQUIRE(parse_digit('y').is_err());
+
+        REQUIRE(string("not a digit") == err.code());
+        REQUIRE("not a digit: x" == err.message());
+    }
+
     SECTION("CtorOkConvert") {
         // converts from const char * to string
         const Result<string, string> res(Ok("Hello"));
@@ -2407,6 +4129,28 @@ TEST_CASE("Result methods", "[Result]") {
         REQUIRE("Hello" == res.get_unchecked());
     }
 
+    SECTION("MakeOkErr") {
+        size_t copy_moves = 0;
+
+        const auto res = make_ok<Tracked, int>(copy_moves, 7);
+        REQUIRE(res.is_ok());
+        REQUIRE(7 == res.get_unchecked().get());
+
+        const auto err_res = make_err<int, Tracked>(copy_moves, 8);
+        REQUIRE(err_res.is_err());
+        REQUIRE(8 == err_res.get_err_unchecked().get());
+        REQUIRE(0 == copy_moves);
+
+        const auto unit_ok_res = make_ok<unit_t, Tracked>();
+        REQUIRE(unit_ok_res.is_ok());
+
+        const auto unit_err_res = make_err<Tracked, unit_t>();
+        REQUIRE(unit_err_res.is_err());
+
+        const auto str_err_res = make_err<unit_t, string>(3, 'x');
+        REQUIRE("xxx" == str_err_res.get_err_unchecked());
+    }
+
     SECTION("CtorErr") {
         const Result<unique_ptr<int>, unique_ptr<string>> res(
             Err(make_unique<string>("Error")));
@@ -2459,6 +4203,133 @@ TEST_CASE("Result methods", "[Result]") {
         REQUIRE("World" == *res.get_unchecked());
     }
 
+    SECTION("AssignmentSwitchThrows") {
+        const Result<ThrowOnCopy, string> ok_res = Ok(ThrowOnCopy(3));
+        Result<ThrowOnCopy, string> res = Err(string("Hello"));
+
+        // the throwing copy happens before the current Err is destroyed
+        REQUIRE_THROWS_AS(res = ok_res, std::runtime_error);
+        REQUIRE(res.is_err());
+        REQUIRE("Hello" == res.get_err_unchecked());
+
+        res = Result<ThrowOnCopy, string>(Ok(ThrowOnCopy(4)));
+        REQUIRE(res.is_ok());
+        REQUIRE(4 == res.get_unchecked().get());
+    }
+
+    SECTION("AssignmentSwitchInPlace") {
+        size_t moves = 0;
+
+        Result<MoveCounted, int> res = Err(1);
+        Result<MoveCounted, int> ok_res = Ok(MoveCounted(moves));
+        moves = 0;
+
+        // moved straight into the switched member without a temporary
+        res = move(ok_res);
+        REQUIRE(res.is_ok());
+        REQUIRE(1 == moves);
+    }
+
+    SECTION("TaggedUnionSized") {
+        static_assert(
+            sizeof(Result<int, int>) == 2 * sizeof(int),
+            "Result<int, int> is expected to have a 1-byte tag after int");
+
+        static_assert(
+            sizeof(Result<double, string>) <= sizeof(string) + sizeof(double),
+            "Result<double, string> is expected to have a 1-byte tag");
+
+        static_assert(
+            !std::is_copy_constructible<Result<unique_ptr<int>, int>>::value,
+            "Result<unique_ptr<int>, int> is expected to be non-copyable");
+
+        static_assert(
+            std::is_nothrow_move_constructible<Result<string, int>>::value,
+            "Result<string, int> is expected to be nothrow movable");
+    }
+
+    SECTION("UnitSized") {
+        static_assert(
+            sizeof(Result<unit_t, unit_t>) == 1,
+            "Result<unit_t, unit_t> is expected to be the tag alone");
+
+        static_assert(
+            sizeof(Result<unit_t, ErrorCode>) == sizeof(ErrorCode),
+            "Result<unit_t, ErrorCode> is expected to be the size of the enum");
+
+        static_assert(
+            sizeof(Result<SlotIndex, unit_t>) == sizeof(SlotIndex),
+            "Result<SlotIndex, unit_t> is expected to be the size of "
+            "SlotIndex");
+
+        static_assert(
+            sizeof(Result<unit_t, int>) == sizeof(Option<int>),
+            "Result<unit_t, int> is expected to be the size of Option<int>");
+
+        static_assert(
+            std::is_trivially_copyable<Result<unit_t, ErrorCode>>::value,
+            "Result<unit_t, ErrorCode> is expected to be trivially copyable");
+    }
+
+    SECTION("UnitErrStates") {
+        Result<unit_t, ErrorCode> res = Ok(Unit);
+        REQUIRE(res.is_ok());
+
+        res = Err(ErrorCode::Invalid);
+        REQUIRE(res.is_err());
+        REQUIRE(ErrorCode::Invalid == res.get_err_unchecked());
+
+        const auto res_copy = res;
+        REQUIRE(res_copy.is_err());
+
+        const auto code = move(res).err().unwrap_or(ErrorCode::NotFound);
+        REQUIRE(ErrorCode::Invalid == code);
+    }
+
+    SECTION("UnitOkStates") {
+        Result<string, unit_t> res = Err(Unit);
+        REQUIRE(res.is_err());
+
+        res = Ok(string("Hello"));
+        REQUIRE(res.is_ok());
+
+        // moved-from Result keeps its state
+        const auto res_moved = move(res);
+        REQUIRE(res.is_ok());
+        REQUIRE(res_moved.is_ok());
+        REQUIRE("Hello" == res_moved.get_unchecked());
+
+        const auto value =
+            Result<string, unit_t>(Err(Unit)).unwrap_or(string("World"));
+
+        REQUIRE("World" == value);
+    }
+
+    SECTION("CopyAcrossStates") {
+        const Result<string, string> res_ok = Ok(string("Hello"));
+        const Result<string, string> res_err = Err(string("World"));
+
+        auto res = res_ok;
+        REQUIRE(res.is_ok());
+        REQUIRE("Hello" == res.get_unchecked());
+
+        res = res_err;
+        REQUIRE(res.is_err());
+        REQUIRE("World" == res.get_err_unchecked());
+
+        res = res_ok;
+        REQUIRE(res.is_ok());
+        REQUIRE("Hello" == res.get_unchecked());
+
+        auto res_moved = move(res);
+        REQUIRE(res_moved.is_ok());
+        REQUIRE("Hello" == res_moved.get_unchecked());
+
+        res_moved = Result<string, string>(Err(string("!")));
+        REQUIRE(res_moved.is_err());
+        REQUIRE("!" == res_moved.get_err_unchecked());
+    }
+
     SECTION("GetUnchecked") {
         const Result<int, string> res = Ok(7);
 
@@ -3104,6 +4975,60 @@ TEST_CASE("Macro expansion", "[Macro]") {
         }
     }
 
+    SECTION("LetUnitErr") {
+        const auto check = [](const int value) -> Result<unit_t, ErrorCode> {
+            if (value < 0) {
+                return Err(ErrorCode::Invalid);
+            }
+
+            return Ok(Unit);
+        };
+
+        const auto fn = [&check](const int lhs, const int rhs)
+            -> Result<unit_t, ErrorCode> {
+
+            ret_if_err(check(lhs));
+            return check(rhs);
+        };
+
+        REQUIRE(fn(1, 2).is_ok());
+        REQUIRE(ErrorCode::Invalid == fn(1, -2).get_err_unchecked());
+    }
+
+    SECTION("LetLazyErr") {
+        size_t format_count = 0;
+
+        const auto check = [&format_count](const int value)
+            -> Result<int, LazyError> {
+
+            if (value % 2 != 0) {
+                return Err(LazyError("odd", [&format_count, value] {
+                    ++format_count;
+                    return "odd value: " + to_string(value);
+                }));
+            }
+
+            return Ok(value / 2);
+        };
+
+        const auto fn = [&check](const int lhs, const int rhs)
+            -> Result<int, LazyError> {
+
+            let(lhs_half, check(lhs));
+            let(rhs_half, check(rhs));
+            return Ok(lhs_half + rhs_half);
+        };
+
+        REQUIRE(3 == fn(2, 4).unwrap_or(0));
+        REQUIRE(0 == fn(2, 5).unwrap_or(0));
+        REQUIRE(0 == format_count);
+
+        const auto res = fn(2, 5);
+        REQUIRE(res.is_err());
+        REQUIRE("odd value: 5" == res.get_err_unchecked().message());
+        REQUIRE(1 == format_count);
+    }
+
     SECTION("LetMut") {
         const auto fn = [](const bool flag,
                            size_t &count) -> Result<int, string> {
@@ -0,0 +1,117 @@
+#include "catch.hpp"
+
+// this file is built into rustfp_unit_test with the branch hints, and into
+// rustfp_unit_test_no_branch_hints with RUSTFP_NO_BRANCH_HINTS defined, so
+// that the Err paths are checked to behave the same either way
+#define RUSTFP_SIMPLIFIED_LET
+#include "rustfp/collect.h"
+#include "rustfp/iter.h"
+#include "rustfp/let.h"
+#include "rustfp/result.h"
+#include "rustfp/specs.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// rustfp
+using rustfp::collect;
+using rustfp::Err;
+using rustfp::into_iter;
+using rustfp::Ok;
+using rustfp::Result;
+
+// std
+using std::move;
+using std::string;
+using std::to_string;
+using std::vector;
+
+#ifdef RUSTFP_NO_BRANCH_HINTS
+#define BRANCH_HINTS_TAG "[BranchHints][NoBranchHints]"
+#else
+#define BRANCH_HINTS_TAG "[BranchHints]"
+#endif
+
+namespace {
+RUSTFP_COLD auto cold_twice(const int value) -> int { return value * 2; }
+} // namespace
+
+TEST_CASE("Branch hints", BRANCH_HINTS_TAG) {
+    SECTION("LikelyUnlikely") {
+        const auto zero = 0;
+        const auto three = 3;
+
+        REQUIRE(RUSTFP_LIKELY(three));
+        REQUIRE(RUSTFP_UNLIKELY(three));
+        REQUIRE_FALSE(RUSTFP_LIKELY(zero));
+        REQUIRE_FALSE(RUSTFP_UNLIKELY(zero));
+        REQUIRE(RUSTFP_LIKELY(three > zero));
+        REQUIRE_FALSE(RUSTFP_UNLIKELY(three < zero));
+    }
+
+    SECTION("Cold") {
+        REQUIRE(6 == cold_twice(3));
+    }
+
+    SECTION("LetRetIfErr") {
+        const auto half = [](const int value) -> Result<int, string> {
+            if (value % 2 != 0) {
+                return Err("odd: " + to_string(value));
+            }
+
+            return Ok(value / 2);
+        };
+
+        const auto fn = [&half](const int lhs, const int rhs)
+            -> Result<int, string> {
+
+            let(lhs_half, half(lhs));
+            ret_if_err(half(rhs));
+            return Ok(lhs_half);
+        };
+
+        REQUIRE(2 == fn(4, 6).get_unchecked());
+        REQUIRE("odd: 3" == fn(3, 6).get_err_unchecked());
+        REQUIRE("odd: 5" == fn(4, 5).get_err_unchecked());
+    }
+
+    SECTION("Match") {
+        const auto ok_res = Result<int, string>(Ok(1));
+        const auto err_res = Result<int, string>(Err(string("err")));
+
+        const auto to_str = [](const Result<int, string> &res) {
+            return res.match([](const int value) { return to_string(value); },
+                             [](const string &e) { return e; });
+        };
+
+        REQUIRE("1" == to_str(ok_res));
+        REQUIRE("err" == to_str(err_res));
+    }
+
+    SECTION("UnwrapOrElse") {
+        const auto def = [] { return -1; };
+
+        auto ok_res = Result<int, string>(Ok(1));
+        auto err_res = Result<int, string>(Err(string("err")));
+
+        REQUIRE(1 == move(ok_res).unwrap_or_else(def));
+        REQUIRE(-1 == move(err_res).unwrap_or_else(def));
+    }
+
+    SECTION("CollectResult") {
+        vector<Result<int, string>> ok_vec{Ok(1), Ok(2)};
+
+        vector<Result<int, string>> err_vec{
+            Ok(1), Err(string("first")), Err(string("second"))};
+
+        const auto ok_res =
+            into_iter(move(ok_vec)) | collect<Result<vector<int>, string>>();
+
+        const auto err_res =
+            into_iter(move(err_vec)) | collect<Result<vector<int>, string>>();
+
+        REQUIRE((vector<int>{1, 2}) == ok_res.get_unchecked());
+        REQUIRE("first" == err_res.get_err_unchecked());
+    }
+}